@@ -1,4 +1,4 @@
-virtualenv -p /usr/bin/python2.7 ./venv; wait
+virtualenv -p /usr/bin/python3 ./venv; wait
 source ./venv/bin/activate
 pip install pytest
 
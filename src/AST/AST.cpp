@@ -2,27 +2,17 @@
 #include "../includes/Scope.hpp"
 
 
-extern Scope* global_scope;
-
-AST::AST() {
-    this->private_scope = new Scope("AST_NODE"); // TODO: maybe not all nodes -
-    // should have a private scope? ...
-}
-
-Scope* AST::get_scope() {
-    if (this->scope == nullptr)
-        return global_scope;
-
-    return this->scope;
-};
-
+AST::AST() {}
+
+/**
+ * Most nodes never need a private scope, so it is only allocated
+ * when asked for.
+ *
+ * @return Scope*
+ */
 Scope* AST::get_private_scope() {
-    return this->private_scope;
-};
+    if (this->private_scope == nullptr)
+        this->private_scope = new Scope("AST_NODE");
 
-Scope* AST::get_parent_scope() {
-    if (this->parent_scope == nullptr)
-        return global_scope;
-
-    return this->parent_scope;
+    return this->private_scope;
 };
@@ -1,4 +1,6 @@
 #include "../includes/AST/AST_Array.hpp"
+#include "../includes/AST/AST_Empty.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
 #include "../includes/memory_utils.hpp"
 
 
@@ -9,3 +11,158 @@ AST_Array::AST_Array(Token* token) {
 AST_Array::~AST_Array() {
     free_vector(this->items);
 };
+
+/**
+ * The value of elements that have not been assigned yet,
+ * shared by all arrays so that presizing does not allocate per element.
+ *
+ * @return AST*
+ */
+AST* AST_Array::empty_item() {
+    static AST_Empty* empty = new AST_Empty(nullptr);
+
+    return empty;
+};
+
+int AST_Array::get_dimension_count() {
+    if (this->dimensions.empty())
+        return 1;
+
+    return this->dimensions.size();
+};
+
+/**
+ * @param int dimension - zero based dimension
+ *
+ * @return int - the number of elements in that dimension, -1 if the
+ * dimension does not exist.
+ */
+int AST_Array::get_length(int dimension) {
+    if (this->dimensions.empty())
+        return dimension == 0 ? (int)this->size() : -1;
+
+    if (dimension < 0 || dimension >= (int)this->dimensions.size())
+        return -1;
+
+    return this->dimensions[dimension];
+};
+
+/**
+ * @param int dimension - zero based dimension
+ *
+ * @return int - the largest index of that dimension, what UBound
+ * returns: -1 for an empty array, -2 if the dimension does not exist.
+ */
+int AST_Array::get_bound(int dimension) {
+    int length = this->get_length(dimension);
+
+    return length < 0 ? -2 : length - 1;
+};
+
+/**
+ * Translates a set of indices into a position in `items`.
+ *
+ * @return int - the offset, -1 if any index is out of bounds.
+ */
+int AST_Array::get_offset(std::vector<int> indices) {
+    if ((int)indices.size() != this->get_dimension_count())
+        return -1;
+
+    int offset = 0;
+
+    for (unsigned int i = 0; i < indices.size(); i++) {
+        int length = this->get_length(i);
+
+        if (indices[i] < 0 || indices[i] >= length)
+            return -1;
+
+        offset = offset * length + indices[i];
+    }
+
+    return offset;
+};
+
+TokenType AST_Array::get_element_type() {
+    return TokenType::Anything;
+};
+
+size_t AST_Array::size() {
+    return this->items.size();
+};
+
+anything AST_Array::get(int offset) {
+    return this->items[offset];
+};
+
+void AST_Array::set(int offset, anything value) {
+    this->items[offset] = value;
+};
+
+/**
+ * Resizes the array, see `redim_buffer`.
+ *
+ * @param std::vector<int> dimensions - number of elements per dimension
+ * @param bool preserve
+ */
+void AST_Array::redim(std::vector<int> dimensions, bool preserve) {
+    anything empty = AST_Array::empty_item();
+
+    redim_buffer(this->items, this->get_length(dimensions.size() - 1), dimensions, preserve, empty);
+    this->dimensions = dimensions;
+};
+
+/**
+ * Iteration used by `For Each`.
+ *
+ * @param size_t& cursor - starts at 0, advanced by every call
+ * @param anything& value - receives the next element
+ *
+ * @return bool - false when there are no more elements
+ */
+bool AST_Array::next(size_t& cursor, anything& value) {
+    if (cursor >= this->size())
+        return false;
+
+    value = this->get(cursor++);
+
+    return true;
+};
+
+/**
+ * Gives access to the elements as a contiguous buffer of doubles,
+ * used by the numeric builtins.
+ *
+ * @param std::vector<double>& scratch - receives the converted elements
+ * when the array does not store doubles itself.
+ * @param bool& integral - set to true if all elements are integers
+ *
+ * @return const double*
+ */
+const double* AST_Array::numeric_data(std::vector<double>& scratch, bool& integral) {
+    integral = true;
+    scratch.resize(this->items.size());
+
+    for (size_t i = 0; i < this->items.size(); i++) {
+        if (this->items[i].type() != typeid(int) && this->items[i].type() != typeid(bool))
+            integral = false;
+
+        scratch[i] = anything_to_number(this->items[i]);
+    }
+
+    return scratch.data();
+};
+
+/**
+ * Subclasses that keep their elements elsewhere are copied into a plain
+ * array through `get`.
+ */
+AST_Array* AST_Array::copy() {
+    AST_Array* array = new AST_Array(nullptr);
+    array->dimensions = this->dimensions;
+    array->items.reserve(this->size());
+
+    for (size_t i = 0; i < this->size(); i++)
+        array->items.push_back(this->get(i));
+
+    return array;
+};
@@ -0,0 +1,11 @@
+#include "../includes/AST/AST_ArrayAssign.hpp"
+
+
+AST_ArrayAssign::AST_ArrayAssign(std::string name, std::vector<AST*> args, Token* op, AST* right) {
+    this->name = name;
+    this->args = args;
+    this->op = op;
+    this->right = right;
+};
+
+AST_ArrayAssign::~AST_ArrayAssign() {};
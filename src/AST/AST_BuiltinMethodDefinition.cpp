@@ -0,0 +1,11 @@
+#include "../includes/AST/AST_BuiltinMethodDefinition.hpp"
+#include "../includes/Interpreter.hpp"
+
+
+AST_BuiltinMethodDefinition::AST_BuiltinMethodDefinition(std::string name) : AST_BuiltinFunctionDefinition(name) {};
+
+AST* AST_BuiltinMethodDefinition::call(std::vector<AST*> args, Interpreter* interpreter) {
+    interpreter->error("Method `" + this->name + "` can only be called on an object");
+
+    return nullptr;
+};
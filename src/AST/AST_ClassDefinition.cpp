@@ -0,0 +1,81 @@
+#include "../includes/AST/AST_ClassDefinition.hpp"
+#include "../includes/AST/AST_ClassMethod.hpp"
+
+
+AST_ClassDefinition::AST_ClassDefinition(std::string name) : methods(name) {
+    this->name = name;
+    this->initialize = nullptr;
+};
+
+AST_ClassDefinition::~AST_ClassDefinition() {};
+
+int AST_ClassDefinition::add_field(std::string name, bool is_public) {
+    Atom atom = intern(name);
+    std::map<Atom, int>::iterator it = this->slots.find(atom);
+
+    if (it != this->slots.end())
+        return it->second;
+
+    int slot = this->fields.size();
+
+    this->fields.push_back(name);
+    this->public_fields.push_back(is_public);
+    this->slots[atom] = slot;
+
+    return slot;
+};
+
+int AST_ClassDefinition::get_slot(Atom name, bool include_private) {
+    std::map<Atom, int>::iterator it = this->slots.find(name);
+
+    if (it == this->slots.end())
+        return -1;
+
+    if (!include_private && !this->public_fields[it->second])
+        return -1;
+
+    return it->second;
+};
+
+/**
+ * @return AST_ClassMethod* - the public member called `name`,
+ * created and added to `methods` on first use.
+ */
+AST_ClassMethod* AST_ClassDefinition::member(std::string name) {
+    Atom atom = intern(name);
+    std::map<Atom, AST_ClassMethod*>::iterator it = this->members.find(atom);
+
+    if (it != this->members.end())
+        return it->second;
+
+    AST_ClassMethod* method = new AST_ClassMethod(*atom);
+
+    this->members[atom] = method;
+    this->methods.define(method);
+
+    return method;
+};
+
+void AST_ClassDefinition::add_method(AST_FunctionDefinition* definition, bool is_public) {
+    this->definitions.push_back(definition);
+
+    if (intern(definition->name) == intern("class_initialize"))
+        this->initialize = definition;
+
+    if (is_public)
+        this->member(definition->name)->getter = definition;
+};
+
+void AST_ClassDefinition::add_property(AST_FunctionDefinition* definition, bool setter, bool is_public) {
+    this->definitions.push_back(definition);
+
+    if (!is_public)
+        return;
+
+    AST_ClassMethod* method = this->member(definition->name);
+
+    if (setter)
+        method->setter = definition;
+    else
+        method->getter = definition;
+};
@@ -0,0 +1,14 @@
+#include "../includes/AST/AST_ClassInstance.hpp"
+#include "../includes/AST/AST_Array.hpp"
+
+
+AST_ClassInstance::AST_ClassInstance(AST_ClassDefinition* definition) : AST_Object(nullptr) {
+    this->definition = definition;
+    this->slots.assign(definition->fields.size(), AST_Array::empty_item());
+};
+
+AST_ClassInstance::~AST_ClassInstance() {};
+
+MethodTable* AST_ClassInstance::get_method_table() {
+    return &this->definition->methods;
+};
@@ -0,0 +1,25 @@
+#include "../includes/AST/AST_ClassMethod.hpp"
+#include "../includes/AST/AST_ClassInstance.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/Interpreter.hpp"
+
+
+AST_ClassMethod::AST_ClassMethod(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->getter = nullptr;
+    this->setter = nullptr;
+    this->unlimited_args = true;
+};
+
+AST_ClassMethod::~AST_ClassMethod() {};
+
+AST* AST_ClassMethod::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_FunctionDefinition* definition = this->getter;
+
+    if (this->setter != nullptr && (definition == nullptr || args.size() == this->setter->args.size()))
+        definition = this->setter;
+
+    if (definition == nullptr)
+        interpreter->error("Property `" + this->name + "` cannot be read");
+
+    return new AST_Value(interpreter->invoke(definition, (AST_ClassInstance*)self, args));
+};
@@ -0,0 +1,10 @@
+#include "../includes/AST/AST_ForEach.hpp"
+
+
+AST_ForEach::AST_ForEach(Token* var, AST* group, AST_Compound* body) {
+    this->var = var;
+    this->group = group;
+    this->body = body;
+};
+
+AST_ForEach::~AST_ForEach() {};
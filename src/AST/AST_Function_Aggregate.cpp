@@ -0,0 +1,47 @@
+#include "../includes/AST/AST_Function_Aggregate.hpp"
+#include "../includes/AST/AST_Array.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+#include "../includes/simd.hpp"
+#include <limits.h>
+
+
+AST_Function_Aggregate::AST_Function_Aggregate(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Array);
+}
+
+AST_Function_Aggregate::~AST_Function_Aggregate() {
+};
+
+AST* AST_Function_Aggregate::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything arr = interpreter->visit(args[0]);
+
+    if (arr.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(arr)))
+        interpreter->error("The argument of " + this->name + " must be an array");
+
+    std::vector<double> scratch;
+    bool integral = false;
+    AST_Array* array = (AST_Array*)boost::get<AST*>(arr);
+    const double* values = array->numeric_data(scratch, integral);
+    size_t length = array->size();
+    double result = 0;
+
+    if (length == 0 && this->name != "sum")
+        interpreter->error(this->name + " of an empty array");
+
+    if (this->name == "sum") {
+        result = simd_sum(values, length);
+    } else if (this->name == "min") {
+        result = simd_min(values, length);
+    } else if (this->name == "max") {
+        result = simd_max(values, length);
+    } else if (this->name == "avg") {
+        result = simd_sum(values, length) / length;
+        integral = false;
+    }
+
+    if (integral && result >= INT_MIN && result <= INT_MAX)
+        return new AST_Value((int)result);
+
+    return new AST_Value((float)result);
+};
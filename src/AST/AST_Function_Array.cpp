@@ -15,7 +15,7 @@ AST* AST_Function_Array::call(std::vector<AST*> args, Interpreter* interpreter)
     AST_Array* arr = new AST_Array(nullptr);
 
     for (std::vector<AST*>::iterator it = args.begin(); it != args.end(); ++it)
-        arr->items.push_back(interpreter->visit((*it)));
+        arr->items.push_back(interpreter->stored(interpreter->visit((*it))));
 
     return arr;
 };
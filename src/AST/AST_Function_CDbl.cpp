@@ -0,0 +1,40 @@
+#include "../includes/AST/AST_Function_CDbl.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_CDbl::AST_Function_CDbl(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_CDbl::~AST_Function_CDbl() {
+};
+
+AST* AST_Function_CDbl::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything value = interpreter->visit(args[0]);
+
+    try {
+        if (value.type() == typeid(AST*) && dynamic_cast<AST_Array*>(boost::get<AST*>(value))) {
+            AST_Array* array = (AST_Array*)boost::get<AST*>(value);
+            AST_TypedArray<double>* doubles = new AST_TypedArray<double>(nullptr, TokenType::Double);
+            bool integral = false;
+
+            doubles->dimensions = array->dimensions;
+
+            const double* values = array->numeric_data(doubles->values, integral);
+
+            // arrays that already store doubles hand out their own buffer
+            if (values != doubles->values.data())
+                doubles->values.assign(values, values + array->size());
+
+            return doubles;
+        }
+
+        return new AST_Value((float)anything_to_number(value));
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("CDbl: ") + e.what());
+    }
+
+    return nullptr;
+};
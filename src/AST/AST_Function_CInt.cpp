@@ -0,0 +1,29 @@
+#include "../includes/AST/AST_Function_CInt.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+#include <math.h>
+
+
+AST_Function_CInt::AST_Function_CInt(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_CInt::~AST_Function_CInt() {
+};
+
+AST* AST_Function_CInt::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything value = interpreter->visit(args[0]);
+    double number = 0;
+
+    try {
+        number = nearbyint(anything_to_number(value));
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("CInt: ") + e.what());
+    }
+
+    if (number < -32768 || number > 32767)
+        interpreter->error("CInt: Overflow");
+
+    return new AST_Value((int)number);
+};
@@ -0,0 +1,22 @@
+#include "../includes/AST/AST_Function_CStr.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_CStr::AST_Function_CStr(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_CStr::~AST_Function_CStr() {
+};
+
+AST* AST_Function_CStr::call(std::vector<AST*> args, Interpreter* interpreter) {
+    try {
+        return new AST_Value(anything_to_string(interpreter->visit(args[0])));
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("CStr: ") + e.what());
+    }
+
+    return nullptr;
+};
@@ -0,0 +1,28 @@
+#include "../includes/AST/AST_Function_ChangeCase.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/StringSearch.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_ChangeCase::AST_Function_ChangeCase(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_ChangeCase::~AST_Function_ChangeCase() {
+};
+
+AST* AST_Function_ChangeCase::call(std::vector<AST*> args, Interpreter* interpreter) {
+    std::string value;
+
+    try {
+        value = anything_to_string(interpreter->visit(args[0]));
+    } catch (std::runtime_error& e) {
+        interpreter->error(this->name + ": " + e.what());
+    }
+
+    if (this->name == "lcase")
+        return new AST_Value(string_lower(value));
+
+    return new AST_Value(string_upper(value));
+};
@@ -1,10 +1,15 @@
 #include "../includes/AST/AST_Function_CreateObject.hpp"
 #include "../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "../includes/AST/builtin_objects/AST_Object_FileSystemObject.hpp"
+#include "../includes/AST/builtin_objects/AST_Object_TaskPool.hpp"
 #include "../includes/AST/AST_ObjectCustom.hpp"
+#include "../includes/AST/AST_ObjectNative.hpp"
 #include "../includes/AST/AST_Object.hpp"
 #include "../includes/Interpreter.hpp"
 #include "../includes/typedefs.hpp"
-#include "../includes/DLClass.hpp"
+#include "../includes/ModuleCache.hpp"
+#include <strings.h>
+#include <atomic>
 #include <iostream>
 
 
@@ -15,6 +20,75 @@ AST_Function_CreateObject::AST_Function_CreateObject(std::string name) : AST_Bui
 AST_Function_CreateObject::~AST_Function_CreateObject() {
 };
 
+#ifdef WSCRIPT_STATIC_REQUESTS
+extern "C" ws_module_entry_t wscript_module_requests;
+#endif
+
+/**
+ * Extensions linked into the interpreter, see STATIC_REQUESTS in the
+ * Makefile. Initialized at compile time, so looking up a ProgID needs
+ * neither dlopen nor any startup work.
+ */
+static const struct {
+    const char* prog_id;
+    ws_module_entry_t* entry;
+} static_extensions[] = {
+#ifdef WSCRIPT_STATIC_REQUESTS
+    { "MSXML2.XMLHTTP", wscript_module_requests },
+    { "Microsoft.XMLHTTP", wscript_module_requests },
+#endif
+    { nullptr, nullptr }
+};
+
+static std::atomic<NativeModule*> static_modules[sizeof(static_extensions) / sizeof(static_extensions[0])];
+
+/**
+ * @return int - index into static_extensions, -1 if `name` is not
+ * linked into the interpreter.
+ */
+static int find_static_extension(std::string name) {
+    for (int i = 0; static_extensions[i].prog_id != nullptr; i++) {
+        if (strcasecmp(static_extensions[i].prog_id, name.c_str()) == 0)
+            return i;
+    }
+
+    return -1;
+};
+
+/**
+ * @return NativeModule* - created on first use, shared by all objects
+ * of the ProgID.
+ */
+static NativeModule* static_module(int index, Interpreter* interpreter) {
+    NativeModule* module = static_modules[index].load();
+
+    if (module != nullptr)
+        return module;
+
+    std::string error;
+    module = NativeModule::from_entry(static_extensions[index].prog_id, nullptr, static_extensions[index].entry, error);
+
+    if (module == nullptr)
+        interpreter->error(error);
+
+    NativeModule* expected = nullptr;
+
+    if (!static_modules[index].compare_exchange_strong(expected, module)) {
+        delete module;
+        module = expected;
+    }
+
+    return module;
+};
+
+/**
+ * @return bool - true for classes that are created without loading
+ * a library.
+ */
+bool AST_Function_CreateObject::is_builtin_class(std::string name) {
+    return name == "Scripting.Dictionary" || name == "Scripting.FileSystemObject" || name == "WScript.TaskPool" || find_static_extension(name) >= 0;
+};
+
 AST* AST_Function_CreateObject::call(std::vector<AST*> args, Interpreter* interpreter) {
     anything type = interpreter->visit(args[0]);
 
@@ -22,13 +96,30 @@ AST* AST_Function_CreateObject::call(std::vector<AST*> args, Interpreter* interp
 
     if (obj_type == "Scripting.Dictionary") {
         return new AST_Object_Dictionary(nullptr);
-    } else {
-        auto someType = new DLClass<AST_ObjectCustom>(obj_type);
+    }
 
-        AST_ObjectCustom* cus = &(*someType->make_obj(0));
+    if (obj_type == "Scripting.FileSystemObject")
+        return new AST_Object_FileSystemObject(nullptr);
 
-        delete someType;
+    if (obj_type == "WScript.TaskPool")
+        return new AST_Object_TaskPool(nullptr);
 
-        return cus;
-    }
+    int index = find_static_extension(obj_type);
+
+    if (index >= 0)
+        return new AST_ObjectNative(static_module(index, interpreter));
+
+    // libraries implementing the native extension ABI come first,
+    // the rest are loaded through the old create/destroy interface
+    ModuleCache::Module* module = ModuleCache::instance()->get(obj_type);
+
+    if (!module->error.empty())
+        interpreter->error(module->error);
+
+    if (module->native != nullptr)
+        return new AST_ObjectNative(module->native);
+
+    AST_ObjectCustom* cus = &(*module->legacy->make_obj(0));
+
+    return cus;
 };
@@ -0,0 +1,44 @@
+#include "../includes/AST/AST_Function_Dot.hpp"
+#include "../includes/AST/AST_Array.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+#include "../includes/simd.hpp"
+#include <limits.h>
+
+
+AST_Function_Dot::AST_Function_Dot(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Array);
+    this->expected_args.push_back(TokenType::Array);
+}
+
+AST_Function_Dot::~AST_Function_Dot() {
+};
+
+AST* AST_Function_Dot::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything left = interpreter->visit(args[0]);
+    anything right = interpreter->visit(args[1]);
+
+    if (left.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(left)))
+        interpreter->error("The first argument of Dot must be an array");
+
+    if (right.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(right)))
+        interpreter->error("The second argument of Dot must be an array");
+
+    AST_Array* left_array = (AST_Array*)boost::get<AST*>(left);
+    AST_Array* right_array = (AST_Array*)boost::get<AST*>(right);
+
+    if (left_array->size() != right_array->size())
+        interpreter->error("Dot requires arrays of the same size");
+
+    std::vector<double> left_scratch, right_scratch;
+    bool left_integral = false, right_integral = false;
+    const double* left_values = left_array->numeric_data(left_scratch, left_integral);
+    const double* right_values = right_array->numeric_data(right_scratch, right_integral);
+
+    double result = simd_dot(left_values, right_values, left_array->size());
+
+    if (left_integral && right_integral && result >= INT_MIN && result <= INT_MAX)
+        return new AST_Value((int)result);
+
+    return new AST_Value((float)result);
+};
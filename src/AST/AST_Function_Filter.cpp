@@ -0,0 +1,47 @@
+#include "../includes/AST/AST_Function_Filter.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/StringSearch.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_Filter::AST_Function_Filter(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Array);
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_Filter::~AST_Function_Filter() {
+};
+
+AST* AST_Function_Filter::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything list = interpreter->visit(args[0]);
+
+    if (list.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(list)))
+        interpreter->error("The argument of filter must be an array");
+
+    AST_Array* array = (AST_Array*)boost::get<AST*>(list);
+    AST_Array* result = new AST_Array(nullptr);
+    std::string value;
+    bool include = true;
+    bool text = false;
+
+    try {
+        value = anything_to_string(interpreter->visit(args[1]));
+
+        if (args.size() >= 3)
+            include = anything_to_number(interpreter->visit(args[2])) != 0;
+        if (args.size() >= 4)
+            text = anything_to_int(interpreter->visit(args[3])) == 1;
+
+        for (size_t i = 0; i < array->size(); i++) {
+            std::string element = anything_to_string(array->get(i));
+            bool found = StringSearch(element, value, text).find(0) != std::string::npos;
+
+            if (found == include)
+                result->items.push_back(element);
+        }
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("Filter: ") + e.what());
+    }
+
+    return result;
+};
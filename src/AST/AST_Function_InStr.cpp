@@ -0,0 +1,50 @@
+#include "../includes/AST/AST_Function_InStr.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/StringSearch.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_InStr::AST_Function_InStr(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_InStr::~AST_Function_InStr() {
+};
+
+AST* AST_Function_InStr::call(std::vector<AST*> args, Interpreter* interpreter) {
+    int start = 1;
+    size_t first = 0;
+    std::string haystack, needle;
+    bool text = false;
+
+    try {
+        // the start position is only optional when compare is left out
+        if (args.size() >= 3) {
+            start = anything_to_int(interpreter->visit(args[0]));
+            first = 1;
+        }
+
+        haystack = anything_to_string(interpreter->visit(args[first]));
+        needle = anything_to_string(interpreter->visit(args[first + 1]));
+
+        if (args.size() >= 4)
+            text = anything_to_int(interpreter->visit(args[3])) == 1;
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("InStr: ") + e.what());
+    }
+
+    if (start < 1)
+        interpreter->error("InStr: Invalid procedure call or argument");
+
+    if ((size_t)start > haystack.size() + 1)
+        return new AST_Value(0);
+
+    if (needle.empty())
+        return new AST_Value(start);
+
+    size_t pos = StringSearch(haystack, needle, text).find(start - 1);
+
+    return new AST_Value(pos == std::string::npos ? 0 : (int)pos + 1);
+};
@@ -0,0 +1,83 @@
+#include "../includes/AST/AST_Function_Join.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Empty.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+#include "../includes/numconv.hpp"
+
+
+AST_Function_Join::AST_Function_Join(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Array);
+}
+
+AST_Function_Join::~AST_Function_Join() {
+};
+
+/**
+ * The text of an element without building a string for it, numbers
+ * are formatted into `buffer`.
+ *
+ * @return const char*
+ */
+static const char* element_text(anything& value, char* buffer, size_t& length) {
+    if (std::string* str = boost::get<std::string>(&value)) {
+        length = str->size();
+        return str->data();
+    }
+
+    if (value.type() == typeid(int))
+        length = format_int(buffer, boost::get<int>(value)) - buffer;
+    else if (value.type() == typeid(float))
+        length = format_float(buffer, boost::get<float>(value)) - buffer;
+    else if (value.type() == typeid(bool))
+        length = (buffer[0] = boost::get<bool>(value) ? '1' : '0', 1);
+    else if (value.type() == typeid(char))
+        length = (buffer[0] = boost::get<char>(value), 1);
+    else if (dynamic_cast<AST_Empty*>(boost::get<AST*>(value)))
+        length = 0;
+    else
+        throw std::runtime_error("Type mismatch: cannot join an object");
+
+    return buffer;
+};
+
+AST* AST_Function_Join::call(std::vector<AST*> args, Interpreter* interpreter) {
+    anything list = interpreter->visit(args[0]);
+
+    if (list.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(list)))
+        interpreter->error("The argument of join must be an array");
+
+    AST_Array* array = (AST_Array*)boost::get<AST*>(list);
+    // variant arrays are read in place, other arrays convert each element
+    bool plain = typeid(*array) == typeid(AST_Array);
+    size_t count = array->size();
+    char buffer[NUMBER_BUFFER_SIZE];
+    size_t length = 0;
+    std::string result;
+
+    try {
+        std::string delimiter = args.size() >= 2 ? anything_to_string(interpreter->visit(args[1])) : " ";
+        size_t total = count > 0 ? delimiter.size() * (count - 1) : 0;
+
+        for (size_t i = 0; i < count; i++) {
+            anything element = plain ? anything() : array->get(i);
+            element_text(plain ? array->items[i] : element, buffer, length);
+            total += length;
+        }
+
+        result.reserve(total);
+
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0)
+                result.append(delimiter);
+
+            anything element = plain ? anything() : array->get(i);
+            const char* text = element_text(plain ? array->items[i] : element, buffer, length);
+            result.append(text, length);
+        }
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("Join: ") + e.what());
+    }
+
+    return new AST_Value(result);
+};
@@ -0,0 +1,37 @@
+#include "../includes/AST/AST_Function_Mid.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_Mid::AST_Function_Mid(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_Mid::~AST_Function_Mid() {
+};
+
+AST* AST_Function_Mid::call(std::vector<AST*> args, Interpreter* interpreter) {
+    std::string value;
+    int start = 1;
+    int length = -1;
+
+    try {
+        value = anything_to_string(interpreter->visit(args[0]));
+        start = anything_to_int(interpreter->visit(args[1]));
+
+        if (args.size() >= 3)
+            length = anything_to_int(interpreter->visit(args[2]));
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("Mid: ") + e.what());
+    }
+
+    if (start < 1 || (args.size() >= 3 && length < 0))
+        interpreter->error("Mid: Invalid procedure call or argument");
+
+    if ((size_t)start > value.size())
+        return new AST_Value(std::string());
+
+    return new AST_Value(value.substr(start - 1, length < 0 ? std::string::npos : (size_t)length));
+};
@@ -22,7 +22,7 @@ AST* AST_Function_Print::call(std::vector<AST*> args, Interpreter* interpreter)
             ) {
 
             anything x = interpreter->visit((*it));
-            coutprint(x);
+            coutprint(interpreter->context->output, x);
         }
     }
 
@@ -0,0 +1,74 @@
+#include "../includes/AST/AST_Function_Replace.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/StringSearch.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_Replace::AST_Function_Replace(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+    this->expected_args.push_back(TokenType::Anything);
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_Replace::~AST_Function_Replace() {
+};
+
+/**
+ * Like VBScript, the result starts at `start`, the part of expression
+ * before it is dropped.
+ */
+AST* AST_Function_Replace::call(std::vector<AST*> args, Interpreter* interpreter) {
+    std::string expression, find, replacement;
+    int start = 1;
+    int count = -1;
+    bool text = false;
+
+    try {
+        expression = anything_to_string(interpreter->visit(args[0]));
+        find = anything_to_string(interpreter->visit(args[1]));
+        replacement = anything_to_string(interpreter->visit(args[2]));
+
+        if (args.size() >= 4)
+            start = anything_to_int(interpreter->visit(args[3]));
+        if (args.size() >= 5)
+            count = anything_to_int(interpreter->visit(args[4]));
+        if (args.size() >= 6)
+            text = anything_to_int(interpreter->visit(args[5])) == 1;
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("Replace: ") + e.what());
+    }
+
+    if (start < 1 || count < -1)
+        interpreter->error("Replace: Invalid procedure call or argument");
+
+    if ((size_t)start > expression.size())
+        return new AST_Value(std::string());
+
+    size_t from = start - 1;
+
+    if (find.empty() || count == 0)
+        return new AST_Value(expression.substr(from));
+
+    StringSearch search(expression, find, text);
+    std::string result;
+    int replaced = 0;
+
+    result.reserve(expression.size() - from);
+
+    while (count < 0 || replaced < count) {
+        size_t pos = search.find(from);
+
+        if (pos == std::string::npos)
+            break;
+
+        result.append(expression, from, pos - from);
+        result.append(replacement);
+        from = pos + find.size();
+        replaced++;
+    }
+
+    result.append(expression, from, std::string::npos);
+
+    return new AST_Value(result);
+};
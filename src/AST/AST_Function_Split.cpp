@@ -1,5 +1,7 @@
 #include "../includes/AST/AST_Function_Split.hpp"
 #include "../includes/AST/AST_Array.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/StringSearch.hpp"
 #include "../includes/typedefs.hpp"
 #include <iostream>
 
@@ -11,6 +13,12 @@ AST_Function_Split::AST_Function_Split(std::string name) : AST_BuiltinFunctionDe
 AST_Function_Split::~AST_Function_Split() {
 };
 
+/**
+ * `Split(expression[, delimiter[, count[, compare]]])`
+ *
+ * Every piece is copied once, so splitting is linear in the length
+ * of expression.
+ */
 AST* AST_Function_Split::call(std::vector<AST*> args, Interpreter* interpreter) {
     if (args.size() == 0)
         return new AST_NoOp();
@@ -20,8 +28,10 @@ AST* AST_Function_Split::call(std::vector<AST*> args, Interpreter* interpreter)
     if (var_value.type() != typeid(std::string))
         interpreter->error("1 argument in Split needs to be string");
 
-    std::string value = boost::get<std::string>(var_value);
+    const std::string& value = boost::get<std::string>(var_value);
     std::string delimiter = " ";
+    int count = -1;
+    bool text = false;
 
     if (args.size() >= 2) {
         anything var_del = interpreter->visit(args[1]);
@@ -30,19 +40,34 @@ AST* AST_Function_Split::call(std::vector<AST*> args, Interpreter* interpreter)
             delimiter = boost::get<std::string>(var_del);
     }
 
+    try {
+        if (args.size() >= 3)
+            count = anything_to_int(interpreter->visit(args[2]));
+        if (args.size() >= 4)
+            text = anything_to_int(interpreter->visit(args[3])) == 1;
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("Split: ") + e.what());
+    }
+
     AST_Array* arr = new AST_Array(nullptr);
 
-    size_t pos = 0;
-    std::string token;
-    while (1) {
+    if (value.empty() || count == 0)
+        return arr;
+
+    StringSearch search(value, delimiter, text);
+    size_t start = 0;
+
+    while (!delimiter.empty() && (count < 0 || (int)arr->items.size() < count - 1)) {
+        size_t pos = search.find(start);
+
         if (pos == std::string::npos)
             break;
 
-        pos = value.find(delimiter);
-        token = value.substr(0, pos);
-        arr->items.push_back(token);
-        value.erase(0, pos + delimiter.length());
+        arr->items.push_back(value.substr(start, pos - start));
+        start = pos + delimiter.length();
     }
 
+    arr->items.push_back(value.substr(start));
+
     return arr;
 };
@@ -0,0 +1,31 @@
+#include "../includes/AST/AST_Function_StrComp.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/StringSearch.hpp"
+#include "../includes/typedefs.hpp"
+
+
+AST_Function_StrComp::AST_Function_StrComp(std::string name) : AST_BuiltinFunctionDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+    this->expected_args.push_back(TokenType::Anything);
+}
+
+AST_Function_StrComp::~AST_Function_StrComp() {
+};
+
+AST* AST_Function_StrComp::call(std::vector<AST*> args, Interpreter* interpreter) {
+    std::string left, right;
+    bool text = false;
+
+    try {
+        left = anything_to_string(interpreter->visit(args[0]));
+        right = anything_to_string(interpreter->visit(args[1]));
+
+        if (args.size() >= 3)
+            text = anything_to_int(interpreter->visit(args[2])) == 1;
+    } catch (std::runtime_error& e) {
+        interpreter->error(std::string("StrComp: ") + e.what());
+    }
+
+    return new AST_Value(string_compare(left, right, text));
+};
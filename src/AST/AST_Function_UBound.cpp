@@ -16,17 +16,31 @@ AST* AST_Function_UBound::call(std::vector<AST*> args, Interpreter* interpreter)
         interpreter->error("UBound requires 1 argument");
 
     anything arr = interpreter->visit(args[0]);
+    int dimension = 1;
+
+    if (args.size() >= 2) {
+        anything _dimension = interpreter->visit(args[1]);
+
+        if (_dimension.type() != typeid(int))
+            interpreter->error("The dimension argument of UBound must be an integer");
+
+        dimension = boost::get<int>(_dimension);
+    }
 
     if (arr.type() == typeid(AST*)) {
         AST* ast = boost::get<AST*>(arr);
 
         if (dynamic_cast<AST_Array*>(ast)) {
             AST_Array* _arr = (AST_Array*)ast;
+            int bound = _arr->get_bound(dimension - 1);
+
+            if (bound < -1)
+                interpreter->error("UBound: array has no dimension " + std::to_string(dimension));
 
-            return new AST_Integer(new Token(TokenType::Integer, std::to_string(_arr->items.size())));
+            return new AST_Integer(new Token(TokenType::Integer, std::to_string(bound)));
         }
     } else if (arr.type() == typeid(std::string)) {
-        return new AST_Integer(new Token(TokenType::Integer, std::to_string(boost::get<std::string>(arr).size())));
+        return new AST_Integer(new Token(TokenType::Integer, std::to_string((int)boost::get<std::string>(arr).size() - 1)));
     }
 
     return nullptr;
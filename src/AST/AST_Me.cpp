@@ -0,0 +1,6 @@
+#include "../includes/AST/AST_Me.hpp"
+
+
+AST_Me::AST_Me() {};
+
+AST_Me::~AST_Me() {};
@@ -0,0 +1,23 @@
+#include "../includes/AST/AST_MemberAccess.hpp"
+
+
+AST_MemberAccess::AST_MemberAccess(AST* object, std::string member, Kind kind, std::vector<AST*> args, AST* value) {
+    this->object = object;
+    this->member = member;
+    this->name = intern(member);
+    this->kind = kind;
+    this->args = args;
+    this->value = value;
+};
+
+AST_MemberAccess::~AST_MemberAccess() {};
+
+std::vector<AST*> AST_MemberAccess::call_args() {
+    if (this->value == nullptr)
+        return this->args;
+
+    std::vector<AST*> args = this->args;
+    args.push_back(this->value);
+
+    return args;
+};
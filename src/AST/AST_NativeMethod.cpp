@@ -0,0 +1,117 @@
+#include "../includes/AST/AST_NativeMethod.hpp"
+#include "../includes/AST/AST_ObjectNative.hpp"
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/AST/AST_Empty.hpp"
+#include "../includes/AST/AST_Value.hpp"
+#include "../includes/Interpreter.hpp"
+
+
+AST_NativeMethod::AST_NativeMethod(const ws_method* method) : AST_BuiltinMethodDefinition(method->name) {
+    this->method = method;
+
+    for (int i = 0; i < method->arity; i++)
+        this->expected_args.push_back(TokenType::Anything);
+};
+
+AST_NativeMethod::~AST_NativeMethod() {};
+
+/**
+ * Strings and byte arrays are borrowed from `value`, which has to
+ * stay alive until the native call returns.
+ */
+static ws_value to_native(anything& value, Interpreter* interpreter) {
+    ws_value native = {};
+
+    if (value.type() == typeid(bool)) {
+        native.type = WS_BOOL;
+        native.as.boolean = boost::get<bool>(value);
+    } else if (value.type() == typeid(int)) {
+        native.type = WS_INT;
+        native.as.integer = boost::get<int>(value);
+    } else if (value.type() == typeid(float)) {
+        native.type = WS_DOUBLE;
+        native.as.number = boost::get<float>(value);
+    } else if (std::string* str = boost::get<std::string>(&value)) {
+        native.type = WS_STRING;
+        native.as.span.data = str->data();
+        native.as.span.size = str->size();
+    } else if (char* c = boost::get<char>(&value)) {
+        native.type = WS_STRING;
+        native.as.span.data = c;
+        native.as.span.size = 1;
+    } else {
+        AST* element = boost::get<AST*>(value);
+
+        if (AST_TypedArray<uint8_t>* bytes = dynamic_cast<AST_TypedArray<uint8_t>*>(element)) {
+            native.type = WS_BYTES;
+            native.as.span.data = (const char*) bytes->values.data();
+            native.as.span.size = bytes->values.size();
+        } else if (dynamic_cast<AST_Empty*>(element)) {
+            native.type = WS_EMPTY;
+        } else {
+            interpreter->error("Cannot pass this value to a native method");
+        }
+    }
+
+    return native;
+};
+
+static void release(ws_value& native) {
+    if (native.release != nullptr)
+        native.release(native.owner);
+};
+
+/**
+ * Converts a returned value, releasing the extension's buffer once it
+ * has been converted.
+ */
+static AST* from_native(ws_value native, Interpreter* interpreter) {
+    switch (native.type) {
+        case WS_EMPTY: return AST_Array::empty_item();
+        case WS_BOOL: return new AST_Value((bool)native.as.boolean);
+        case WS_INT: return new AST_Value(native.as.integer);
+        case WS_DOUBLE: return new AST_Value((float)native.as.number);
+        case WS_STRING: {
+            anything value = std::string(native.as.span.data, native.as.span.size);
+            release(native);
+
+            return new AST_Value(value);
+        }
+        case WS_BYTES: {
+            AST_TypedArray<uint8_t>* bytes = (AST_TypedArray<uint8_t>*) new_typed_array(TokenType::Byte);
+            const uint8_t* data = (const uint8_t*) native.as.span.data;
+
+            bytes->values.assign(data, data + native.as.span.size);
+            release(native);
+
+            return new AST_Value((AST*)bytes);
+        }
+        case WS_ERROR: {
+            std::string message(native.as.span.data, native.as.span.size);
+            release(native);
+
+            interpreter->error(message);
+        }
+    }
+
+    interpreter->error("Native method returned an unknown value type");
+
+    return nullptr;
+};
+
+AST* AST_NativeMethod::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    if ((int)args.size() != this->method->arity)
+        interpreter->error("Wrong number of arguments when calling: " + this->name);
+
+    std::vector<anything> values(args.size());
+    std::vector<ws_value> natives(args.size());
+
+    for (size_t i = 0; i < args.size(); i++) {
+        values[i] = interpreter->visit(args[i]);
+        natives[i] = to_native(values[i], interpreter);
+    }
+
+    void* instance = ((AST_ObjectNative*)self)->self;
+
+    return from_native(this->method->fn(instance, natives.data()), interpreter);
+};
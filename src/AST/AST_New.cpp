@@ -0,0 +1,8 @@
+#include "../includes/AST/AST_New.hpp"
+
+
+AST_New::AST_New(std::string name) {
+    this->name = name;
+};
+
+AST_New::~AST_New() {};
@@ -6,3 +6,7 @@ AST_Object::AST_Object(Token* token) : AST() {
 };
 
 AST_Object::~AST_Object() {};
+
+MethodTable* AST_Object::get_method_table() {
+    return nullptr;
+};
@@ -1,4 +1,13 @@
 #include "../includes/AST/AST_ObjectCustom.hpp"
 
 
-AST_ObjectCustom::AST_ObjectCustom(Token* token) : AST_Object(token) {};
+#include "../includes/Scope.hpp"
+
+
+/**
+ * Extensions define their methods directly in `private_scope`,
+ * so custom objects allocate it up front.
+ */
+AST_ObjectCustom::AST_ObjectCustom(Token* token) : AST_Object(token) {
+    this->get_private_scope();
+};
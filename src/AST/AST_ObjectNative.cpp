@@ -0,0 +1,15 @@
+#include "../includes/AST/AST_ObjectNative.hpp"
+
+
+AST_ObjectNative::AST_ObjectNative(NativeModule* module) : AST_Object(nullptr) {
+    this->module = module;
+    this->self = module->module->create();
+};
+
+AST_ObjectNative::~AST_ObjectNative() {
+    this->module->module->destroy(this->self);
+};
+
+MethodTable* AST_ObjectNative::get_method_table() {
+    return this->module->methods;
+};
@@ -0,0 +1,11 @@
+#include "../includes/AST/AST_ReDim.hpp"
+
+
+AST_ReDim::AST_ReDim(std::vector<Token*> tokens, std::map<std::string, std::vector<AST*> > arrays, std::map<std::string, TokenType> types, bool preserve) {
+    this->tokens = tokens;
+    this->arrays = arrays;
+    this->types = types;
+    this->preserve = preserve;
+};
+
+AST_ReDim::~AST_ReDim() {};
@@ -0,0 +1,10 @@
+#include "../includes/AST/AST_SlotAccess.hpp"
+
+
+AST_SlotAccess::AST_SlotAccess(int slot, std::string name, std::vector<AST*> args) {
+    this->slot = slot;
+    this->name = name;
+    this->args = args;
+};
+
+AST_SlotAccess::~AST_SlotAccess() {};
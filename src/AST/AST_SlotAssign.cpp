@@ -0,0 +1,11 @@
+#include "../includes/AST/AST_SlotAssign.hpp"
+
+
+AST_SlotAssign::AST_SlotAssign(int slot, std::string name, std::vector<AST*> args, AST* value) {
+    this->slot = slot;
+    this->name = name;
+    this->args = args;
+    this->value = value;
+};
+
+AST_SlotAssign::~AST_SlotAssign() {};
@@ -0,0 +1,192 @@
+#include "../includes/AST/AST_TypedArray.hpp"
+#include "../includes/memory_utils.hpp"
+#include "../includes/numconv.hpp"
+#include "../includes/AST/AST_Empty.hpp"
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdexcept>
+#include <limits>
+
+
+template <class T>
+AST_TypedArray<T>::AST_TypedArray(Token* token, TokenType element_type) : AST_Array(token) {
+    this->element_type = element_type;
+};
+
+template <class T>
+AST_TypedArray<T>::~AST_TypedArray() {
+    free_vector(this->values);
+};
+
+template <class T>
+TokenType AST_TypedArray<T>::get_element_type() {
+    return this->element_type;
+};
+
+template <class T>
+size_t AST_TypedArray<T>::size() {
+    return this->values.size();
+};
+
+template <class T>
+anything AST_TypedArray<T>::get(int offset) {
+    return AST_TypedArray<T>::to_anything(this->values[offset]);
+};
+
+template <class T>
+void AST_TypedArray<T>::set(int offset, anything value) {
+    this->values[offset] = AST_TypedArray<T>::from_anything(value);
+};
+
+template <class T>
+void AST_TypedArray<T>::redim(std::vector<int> dimensions, bool preserve) {
+    redim_buffer(this->values, this->get_length(dimensions.size() - 1), dimensions, preserve, T());
+    this->dimensions = dimensions;
+};
+
+double anything_to_number(anything value) {
+    if (value.type() == typeid(int))
+        return boost::get<int>(value);
+    if (value.type() == typeid(float))
+        return boost::get<float>(value);
+    if (value.type() == typeid(bool))
+        return boost::get<bool>(value);
+    if (value.type() == typeid(char))
+        return boost::get<char>(value);
+    if (value.type() == typeid(AST*))
+        return 0;
+
+    const std::string& str = boost::get<std::string>(value);
+    const char* last = str.data() + str.size();
+    double number = 0;
+
+    if (str.empty() || parse_double(str.data(), last, number) != last)
+        throw std::runtime_error("Type mismatch: `" + str + "` is not a number");
+
+    return number;
+};
+
+int anything_to_int(anything value) {
+    if (value.type() == typeid(int))
+        return boost::get<int>(value);
+
+    return (int)nearbyint(anything_to_number(value));
+};
+
+std::string anything_to_string(anything value) {
+    if (value.type() == typeid(std::string))
+        return boost::get<std::string>(value);
+    if (value.type() == typeid(int))
+        return int_to_string(boost::get<int>(value));
+    if (value.type() == typeid(float))
+        return float_to_string(boost::get<float>(value));
+    if (value.type() == typeid(bool))
+        return boost::get<bool>(value) ? "1" : "0";
+    if (value.type() == typeid(char))
+        return std::string(1, boost::get<char>(value));
+    if (dynamic_cast<AST_Empty*>(boost::get<AST*>(value)))
+        return "";
+
+    throw std::runtime_error("Type mismatch: cannot convert an object to a string");
+};
+
+/**
+ * Integer element types round half to even, like CInt and CLng, values
+ * out of the element type's range are an Overflow like they are for CInt.
+ */
+template <class T>
+static T anything_to_integer(anything value) {
+    double number = value.type() == typeid(int) ? boost::get<int>(value) : nearbyint(anything_to_number(value));
+
+    if (!(number >= std::numeric_limits<T>::min() && number <= std::numeric_limits<T>::max()))
+        throw std::runtime_error("Overflow");
+
+    return (T)number;
+};
+
+template <>
+double AST_TypedArray<double>::from_anything(anything value) { return anything_to_number(value); };
+template <>
+float AST_TypedArray<float>::from_anything(anything value) { return anything_to_number(value); };
+template <>
+int32_t AST_TypedArray<int32_t>::from_anything(anything value) { return anything_to_integer<int32_t>(value); };
+template <>
+int16_t AST_TypedArray<int16_t>::from_anything(anything value) { return anything_to_integer<int16_t>(value); };
+template <>
+uint8_t AST_TypedArray<uint8_t>::from_anything(anything value) { return anything_to_integer<uint8_t>(value); };
+template <>
+bool AST_TypedArray<bool>::from_anything(anything value) { return anything_to_number(value) != 0; };
+template <>
+std::string AST_TypedArray<std::string>::from_anything(anything value) { return anything_to_string(value); };
+
+/* a variant holds no double, read elements are narrowed to Single */
+template <>
+anything AST_TypedArray<double>::to_anything(double value) { return (float)value; };
+template <>
+anything AST_TypedArray<float>::to_anything(float value) { return value; };
+template <>
+anything AST_TypedArray<int32_t>::to_anything(int32_t value) { return (int)value; };
+template <>
+anything AST_TypedArray<int16_t>::to_anything(int16_t value) { return (int)value; };
+template <>
+anything AST_TypedArray<uint8_t>::to_anything(uint8_t value) { return (int)value; };
+template <>
+anything AST_TypedArray<bool>::to_anything(bool value) { return value; };
+template <>
+anything AST_TypedArray<std::string>::to_anything(std::string value) { return value; };
+
+static double element_to_number(float value) { return value; };
+static double element_to_number(int32_t value) { return value; };
+static double element_to_number(int16_t value) { return value; };
+static double element_to_number(uint8_t value) { return value; };
+static double element_to_number(bool value) { return value; };
+static double element_to_number(std::string value) { return anything_to_number(value); };
+
+template <class T>
+const double* AST_TypedArray<T>::numeric_data(std::vector<double>& scratch, bool& integral) {
+    integral = this->element_type != TokenType::Double && this->element_type != TokenType::Single && this->element_type != TokenType::String;
+    scratch.resize(this->values.size());
+
+    for (size_t i = 0; i < this->values.size(); i++)
+        scratch[i] = element_to_number((T)this->values[i]);
+
+    return scratch.data();
+};
+
+template <>
+const double* AST_TypedArray<double>::numeric_data(std::vector<double>& scratch, bool& integral) {
+    integral = false;
+
+    return this->values.data();
+};
+
+template <class T>
+AST_Array* AST_TypedArray<T>::copy() {
+    AST_TypedArray<T>* array = new AST_TypedArray<T>(nullptr, this->element_type);
+    array->dimensions = this->dimensions;
+    array->values = this->values;
+
+    return array;
+};
+
+template class AST_TypedArray<double>;
+template class AST_TypedArray<float>;
+template class AST_TypedArray<int32_t>;
+template class AST_TypedArray<int16_t>;
+template class AST_TypedArray<uint8_t>;
+template class AST_TypedArray<bool>;
+template class AST_TypedArray<std::string>;
+
+AST_Array* new_typed_array(TokenType element_type) {
+    switch (element_type) {
+        case TokenType::Double: return new AST_TypedArray<double>(nullptr, element_type);
+        case TokenType::Single: return new AST_TypedArray<float>(nullptr, element_type);
+        case TokenType::Long: return new AST_TypedArray<int32_t>(nullptr, element_type);
+        case TokenType::Integer: return new AST_TypedArray<int16_t>(nullptr, element_type);
+        case TokenType::Byte: return new AST_TypedArray<uint8_t>(nullptr, element_type);
+        case TokenType::Boolean: return new AST_TypedArray<bool>(nullptr, element_type);
+        case TokenType::String: return new AST_TypedArray<std::string>(nullptr, element_type);
+        default: return nullptr;
+    }
+};
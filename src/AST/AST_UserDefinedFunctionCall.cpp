@@ -2,6 +2,7 @@
 #include "../includes/AST/AST_Var.hpp"
 #include "../includes/AST/AST_NoOp.hpp"
 #include "../includes/Interpreter.hpp"
+#include "../includes/ExecutionContext.hpp"
 #include <iostream>
 
 
@@ -12,8 +13,10 @@ AST_UserDefinedFunctionCall::AST_UserDefinedFunctionCall(std::vector<AST*> args,
 AST_UserDefinedFunctionCall::~AST_UserDefinedFunctionCall() {};
 
 AST* AST_UserDefinedFunctionCall::call(Interpreter* interpreter) {
-    if (this->definition != nullptr)
-        return this->definition->body;
+    AST_FunctionDefinition* definition = interpreter->context->frame(this->scope)->get_function_definition(this->name);
+
+    if (definition != nullptr)
+        return definition->body;
 
     return new AST_NoOp();
 };
@@ -0,0 +1,8 @@
+#include "../includes/AST/AST_Value.hpp"
+
+
+AST_Value::AST_Value(anything value) {
+    this->value = value;
+};
+
+AST_Value::~AST_Value() {};
@@ -1,8 +1,10 @@
 #include "../includes/AST/AST_VarDecl.hpp"
 
 
-AST_VarDecl::AST_VarDecl(std::vector<Token*> tokens) {
+AST_VarDecl::AST_VarDecl(std::vector<Token*> tokens, std::map<std::string, std::vector<AST*> > arrays, std::map<std::string, TokenType> types) {
     this->tokens = tokens;
+    this->arrays = arrays;
+    this->types = types;
 };
 
 AST_VarDecl::~AST_VarDecl() {};
@@ -0,0 +1,10 @@
+#include "../includes/AST/AST_With.hpp"
+
+
+AST_With::AST_With(AST* target, AST_Compound* body, int depth) {
+    this->target = target;
+    this->body = body;
+    this->depth = depth;
+};
+
+AST_With::~AST_With() {};
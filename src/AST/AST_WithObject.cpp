@@ -0,0 +1,8 @@
+#include "../includes/AST/AST_WithObject.hpp"
+
+
+AST_WithObject::AST_WithObject(int depth) {
+    this->depth = depth;
+};
+
+AST_WithObject::~AST_WithObject() {};
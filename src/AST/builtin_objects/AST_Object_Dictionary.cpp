@@ -1,14 +1,37 @@
 #include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
-#include "../../includes/Scope.hpp"
 
 
 AST_Object_Dictionary::AST_Object_Dictionary(Token* token) : AST_Object(token) {
     this->token = token;
-    this->private_scope->define_builtin_function(new AST_Object_Dictionary_Add("add", this));
-    this->private_scope->define_builtin_function(new AST_Object_Dictionary_Exists("exists", this));
-    this->private_scope->define_builtin_function(new AST_Object_Dictionary_Keys("keys", this));
-    this->private_scope->define_builtin_function(new AST_Object_Dictionary_Items("items", this));
-    this->private_scope->define_builtin_function(new AST_Object_Dictionary_RemoveAll("removeall", this));
 };
 
 AST_Object_Dictionary::~AST_Object_Dictionary() {};
+
+MethodTable* AST_Object_Dictionary::get_method_table() {
+    return AST_Object_Dictionary::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("Scripting.Dictionary");
+
+    table->define(new AST_Object_Dictionary_Add("add"));
+    table->define(new AST_Object_Dictionary_Exists("exists"));
+    table->define(new AST_Object_Dictionary_Keys("keys"));
+    table->define(new AST_Object_Dictionary_Items("items"));
+    table->define(new AST_Object_Dictionary_RemoveAll("removeall"));
+    table->define(new AST_Object_Dictionary_Remove("remove"));
+    table->define(new AST_Object_Dictionary_Item("item"));
+    table->define(new AST_Object_Dictionary_Count("count"));
+    table->define(new AST_Object_Dictionary_CompareMode("comparemode"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all dictionaries.
+ */
+MethodTable* AST_Object_Dictionary::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
@@ -0,0 +1,34 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary_CompareMode.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/AST/AST_NoOp.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_Dictionary_CompareMode::AST_Object_Dictionary_CompareMode(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_Dictionary_CompareMode::~AST_Object_Dictionary_CompareMode() {};
+
+/**
+ * `d.CompareMode` returns 0 (vbBinaryCompare) or 1 (vbTextCompare),
+ * `d.CompareMode = 1` arrives here with the mode as argument.
+ */
+AST* AST_Object_Dictionary_CompareMode::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    HashTable* table = &((AST_Object_Dictionary*)self)->table;
+
+    if (args.size() == 0)
+        return new AST_Value((int)table->text_compare);
+
+    anything mode = interpreter->visit(args[0]);
+
+    if (mode.type() != typeid(int))
+        interpreter->error("CompareMode must be an integer");
+
+    if (table->count() != 0)
+        interpreter->error("CompareMode can only be changed on an empty dictionary");
+
+    table->text_compare = boost::get<int>(mode) != 0;
+
+    return new AST_NoOp();
+};
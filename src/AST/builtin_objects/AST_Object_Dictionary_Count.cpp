@@ -0,0 +1,14 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary_Count.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_Dictionary_Count::AST_Object_Dictionary_Count(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_Dictionary_Count::~AST_Object_Dictionary_Count() {};
+
+AST* AST_Object_Dictionary_Count::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    return new AST_Value((int)((AST_Object_Dictionary*)self)->table.count());
+};
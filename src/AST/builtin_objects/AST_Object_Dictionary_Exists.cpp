@@ -1,28 +1,21 @@
 #include "../../includes/AST/builtin_objects/AST_Object_Dictionary_Exists.hpp"
 #include "../../includes/AST/AST_Integer.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
 #include "../../includes/typedefs.hpp"
 #include <iostream>
 
 
-AST_Object_Dictionary_Exists::AST_Object_Dictionary_Exists(std::string name, AST_Object* obj) : AST_BuiltinFunctionDefinition(name) {
-    this->obj = obj;
+AST_Object_Dictionary_Exists::AST_Object_Dictionary_Exists(std::string name) : AST_BuiltinMethodDefinition(name) {
     this->expected_args.push_back(TokenType::String);
 }
 
-AST_Object_Dictionary_Exists::~AST_Object_Dictionary_Exists() {
-    delete this->obj;
-};
+AST_Object_Dictionary_Exists::~AST_Object_Dictionary_Exists() {};
 
-AST* AST_Object_Dictionary_Exists::call(std::vector<AST*> args, Interpreter* interpreter) {
+AST* AST_Object_Dictionary_Exists::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
     anything x = interpreter->visit(args[0]);
     int _exists = 0;
 
-    if (x.type() != typeid(std::string))
-        interpreter->error("First argument in Exists must be string");
-
-    std::string key = boost::get<std::string>(x);
-
-    if (this->obj->get_private_scope()->variables.find(key) != this->obj->get_private_scope()->variables.end())
+    if (((AST_Object_Dictionary*)self)->table.find(x) != nullptr)
         _exists = 1;
 
     // TODO: return AST_Boolean
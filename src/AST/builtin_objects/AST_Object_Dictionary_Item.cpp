@@ -0,0 +1,38 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary_Item.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "../../includes/AST/AST_Array.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_Dictionary_Item::AST_Object_Dictionary_Item(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+};
+
+AST_Object_Dictionary_Item::~AST_Object_Dictionary_Item() {};
+
+/**
+ * `d.Item(key)` returns the value for key, a missing key is added with
+ * an Empty value like VBScript does.
+ * `d.Item(key) = value` arrives here with the value as second argument.
+ */
+AST* AST_Object_Dictionary_Item::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    HashTable* table = &((AST_Object_Dictionary*)self)->table;
+    anything key = interpreter->visit(args[0]);
+
+    if (args.size() >= 2) {
+        anything value = interpreter->stored(interpreter->visit(args[1]));
+        table->set(key, value);
+
+        return new AST_Value(value);
+    }
+
+    anything* value = table->find(key);
+
+    if (value == nullptr) {
+        table->set(key, AST_Array::empty_item());
+        return AST_Array::empty_item();
+    }
+
+    return new AST_Value(*value);
+};
@@ -0,0 +1,20 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary_Remove.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "../../includes/AST/AST_NoOp.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_Dictionary_Remove::AST_Object_Dictionary_Remove(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::Anything);
+};
+
+AST_Object_Dictionary_Remove::~AST_Object_Dictionary_Remove() {};
+
+AST* AST_Object_Dictionary_Remove::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    HashTable* table = &((AST_Object_Dictionary*)self)->table;
+
+    if (!table->remove(interpreter->visit(args[0])))
+        interpreter->error("Remove: the key does not exist");
+
+    return new AST_NoOp();
+};
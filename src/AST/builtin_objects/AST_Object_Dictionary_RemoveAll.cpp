@@ -1,18 +1,16 @@
 #include "../../includes/AST/builtin_objects/AST_Object_Dictionary_RemoveAll.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
 #include "../../includes/typedefs.hpp"
 #include <iostream>
 
 
-AST_Object_Dictionary_RemoveAll::AST_Object_Dictionary_RemoveAll(std::string name, AST_Object* obj) : AST_BuiltinFunctionDefinition(name) {
-    this->obj = obj;
+AST_Object_Dictionary_RemoveAll::AST_Object_Dictionary_RemoveAll(std::string name) : AST_BuiltinMethodDefinition(name) {
 };
 
-AST_Object_Dictionary_RemoveAll::~AST_Object_Dictionary_RemoveAll() {
-    delete this->obj;
-};
+AST_Object_Dictionary_RemoveAll::~AST_Object_Dictionary_RemoveAll() {};
 
-AST* AST_Object_Dictionary_RemoveAll::call(std::vector<AST*> args, Interpreter* interpreter) {
-    this->obj->get_private_scope()->variables.clear();
+AST* AST_Object_Dictionary_RemoveAll::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    ((AST_Object_Dictionary*)self)->table.clear();
 
     return new AST_NoOp();
 };
@@ -0,0 +1,108 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Dictionary_View.hpp"
+
+
+AST_Object_Dictionary_View::AST_Object_Dictionary_View(HashTable* table, bool values) : AST_Array(nullptr) {
+    this->table = table;
+    this->values = values;
+    this->materialized = false;
+    this->end = 0;
+    this->modifications = 0;
+    this->stop_order = 0;
+    this->resume_order = 0;
+};
+
+AST_Object_Dictionary_View::~AST_Object_Dictionary_View() {};
+
+/**
+ * Copies the keys (or values) into `items` and detaches the view
+ * from the dictionary.
+ */
+void AST_Object_Dictionary_View::materialize() {
+    if (this->materialized)
+        return;
+
+    this->items.reserve(this->table->count());
+
+    for (std::vector<HashTable::Entry>::iterator it = this->table->entries.begin(); it != this->table->entries.end(); ++it)
+        if (!it->removed)
+            this->items.push_back(this->values ? it->value : it->key);
+
+    this->materialized = true;
+};
+
+size_t AST_Object_Dictionary_View::size() {
+    if (this->materialized)
+        return this->items.size();
+
+    return this->table->count();
+};
+
+anything AST_Object_Dictionary_View::get(int offset) {
+    // entries can only be indexed directly when nothing has been removed
+    if (!this->materialized && this->table->count() == this->table->entries.size()) {
+        HashTable::Entry& entry = this->table->entries[offset];
+
+        return this->values ? entry.value : entry.key;
+    }
+
+    this->materialize();
+
+    return this->items[offset];
+};
+
+void AST_Object_Dictionary_View::set(int offset, anything value) {
+    this->materialize();
+    AST_Array::set(offset, value);
+};
+
+void AST_Object_Dictionary_View::redim(std::vector<int> dimensions, bool preserve) {
+    this->materialize();
+    AST_Array::redim(dimensions, preserve);
+};
+
+/**
+ * Walks the dictionary in insertion order, skipping removed entries.
+ * Entries added while iterating are not visited.
+ *
+ * The loop stops at the entries the table had when it started. If the
+ * table moved its entries since the previous step (see
+ * `HashTable::modifications`), the cursor and the end are found again
+ * by the insertion order of the entries.
+ */
+bool AST_Object_Dictionary_View::next(size_t& cursor, anything& value) {
+    if (this->materialized)
+        return AST_Array::next(cursor, value);
+
+    if (cursor == 0) {
+        this->end = this->table->entries.size();
+        this->modifications = this->table->modifications;
+        this->stop_order = this->table->next_order;
+        this->resume_order = 0;
+    }
+
+    if (this->table->modifications != this->modifications) {
+        cursor = this->table->position(this->resume_order);
+        this->end = this->table->position(this->stop_order);
+        this->modifications = this->table->modifications;
+    }
+
+    std::vector<HashTable::Entry>& entries = this->table->entries;
+
+    while (cursor < this->end && entries[cursor].removed)
+        cursor++;
+
+    if (cursor >= this->end)
+        return false;
+
+    value = this->values ? entries[cursor].value : entries[cursor].key;
+    this->resume_order = entries[cursor].order + 1;
+    cursor++;
+
+    return true;
+};
+
+const double* AST_Object_Dictionary_View::numeric_data(std::vector<double>& scratch, bool& integral) {
+    this->materialize();
+
+    return AST_Array::numeric_data(scratch, integral);
+};
@@ -0,0 +1,54 @@
+#include "../../includes/AST/builtin_objects/AST_Object_File.hpp"
+
+
+AST_Object_File::AST_Object_File(std::string path) : AST_Object(nullptr) {
+    this->path = path;
+    this->loaded = false;
+    this->found = false;
+};
+
+AST_Object_File::~AST_Object_File() {};
+
+struct stat* AST_Object_File::attributes() {
+    if (!this->loaded) {
+        this->found = stat(this->path.c_str(), &this->info) == 0;
+        this->loaded = true;
+    }
+
+    return this->found ? &this->info : nullptr;
+};
+
+std::string AST_Object_File::name() {
+    size_t end = this->path.find_last_not_of('/');
+
+    if (end == std::string::npos)
+        return this->path.substr(0, 1);
+
+    size_t start = this->path.rfind('/', end);
+    start = start == std::string::npos ? 0 : start + 1;
+
+    return this->path.substr(start, end - start + 1);
+};
+
+MethodTable* AST_Object_File::get_method_table() {
+    return AST_Object_File::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("File");
+
+    table->define(new AST_Object_File_Name("name"));
+    table->define(new AST_Object_File_Name("path"));
+    table->define(new AST_Object_File_Size("size"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all files.
+ */
+MethodTable* AST_Object_File::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
@@ -0,0 +1,36 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject.hpp"
+
+
+AST_Object_FileSystemObject::AST_Object_FileSystemObject(Token* token) : AST_Object(token) {
+    this->token = token;
+};
+
+AST_Object_FileSystemObject::~AST_Object_FileSystemObject() {};
+
+MethodTable* AST_Object_FileSystemObject::get_method_table() {
+    return AST_Object_FileSystemObject::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("Scripting.FileSystemObject");
+
+    table->define(new AST_Object_FileSystemObject_OpenTextFile("opentextfile"));
+    table->define(new AST_Object_FileSystemObject_OpenTextFile("createtextfile"));
+    table->define(new AST_Object_FileSystemObject_FileExists("fileexists"));
+    table->define(new AST_Object_FileSystemObject_DeleteFile("deletefile"));
+    table->define(new AST_Object_FileSystemObject_GetFolder("getfolder"));
+    table->define(new AST_Object_FileSystemObject_GetFolder("getfile"));
+    table->define(new AST_Object_FileSystemObject_GetFolder("folderexists"));
+    table->define(new AST_Object_FileSystemObject_CreateFolder("createfolder"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all instances.
+ */
+MethodTable* AST_Object_FileSystemObject::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
@@ -0,0 +1,29 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject_CreateFolder.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Folder.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/typedefs.hpp"
+#include <sys/stat.h>
+#include <errno.h>
+#include <string.h>
+
+
+AST_Object_FileSystemObject_CreateFolder::AST_Object_FileSystemObject_CreateFolder(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+};
+
+AST_Object_FileSystemObject_CreateFolder::~AST_Object_FileSystemObject_CreateFolder() {};
+
+AST* AST_Object_FileSystemObject_CreateFolder::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    std::string path = anything_to_string(interpreter->visit(args[0]));
+
+    if (mkdir(path.c_str(), 0777) != 0) {
+        if (errno == EEXIST)
+            interpreter->error(this->name + ": File already exists: " + path);
+        else if (errno == ENOENT)
+            interpreter->error(this->name + ": Path not found: " + path);
+
+        interpreter->error(this->name + ": " + strerror(errno) + ": " + path);
+    }
+
+    return new AST_Object_Folder(path);
+};
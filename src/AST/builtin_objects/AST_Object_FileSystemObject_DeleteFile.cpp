@@ -0,0 +1,27 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject_DeleteFile.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+
+AST_Object_FileSystemObject_DeleteFile::AST_Object_FileSystemObject_DeleteFile(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+};
+
+AST_Object_FileSystemObject_DeleteFile::~AST_Object_FileSystemObject_DeleteFile() {};
+
+AST* AST_Object_FileSystemObject_DeleteFile::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    std::string path = anything_to_string(interpreter->visit(args[0]));
+
+    if (unlink(path.c_str()) != 0) {
+        if (errno == ENOENT)
+            interpreter->error(this->name + ": File not found: " + path);
+
+        interpreter->error(this->name + ": " + strerror(errno) + ": " + path);
+    }
+
+    return new AST_Value(0);
+};
@@ -0,0 +1,20 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject_FileExists.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+#include <sys/stat.h>
+
+
+AST_Object_FileSystemObject_FileExists::AST_Object_FileSystemObject_FileExists(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+};
+
+AST_Object_FileSystemObject_FileExists::~AST_Object_FileSystemObject_FileExists() {};
+
+AST* AST_Object_FileSystemObject_FileExists::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    std::string path = anything_to_string(interpreter->visit(args[0]));
+    struct stat info;
+
+    // TODO: return AST_Boolean
+    return new AST_Value((int)(stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode)));
+};
@@ -0,0 +1,40 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject_GetFolder.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Folder.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+#include <sys/stat.h>
+
+
+AST_Object_FileSystemObject_GetFolder::AST_Object_FileSystemObject_GetFolder(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+};
+
+AST_Object_FileSystemObject_GetFolder::~AST_Object_FileSystemObject_GetFolder() {};
+
+/**
+ * `GetFolder(path)`, `GetFile(path)` and `FolderExists(path)`, told
+ * apart by the method name.
+ */
+AST* AST_Object_FileSystemObject_GetFolder::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    std::string path = anything_to_string(interpreter->visit(args[0]));
+    struct stat info;
+    bool found = stat(path.c_str(), &info) == 0;
+    bool directory = found && S_ISDIR(info.st_mode);
+
+    if (this->name == "folderexists")
+        // TODO: return AST_Boolean
+        return new AST_Value((int)directory);
+
+    if (this->name == "getfolder") {
+        if (!directory)
+            interpreter->error(this->name + ": Path not found: " + path);
+
+        return new AST_Object_Folder(path);
+    }
+
+    if (!found || directory)
+        interpreter->error(this->name + ": File not found: " + path);
+
+    return new AST_Object_File(path);
+};
@@ -0,0 +1,65 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FileSystemObject_OpenTextFile.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/typedefs.hpp"
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+
+
+AST_Object_FileSystemObject_OpenTextFile::AST_Object_FileSystemObject_OpenTextFile(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+};
+
+AST_Object_FileSystemObject_OpenTextFile::~AST_Object_FileSystemObject_OpenTextFile() {};
+
+/**
+ * `OpenTextFile(path[, iomode[, create]])` with iomode 1 (reading, the
+ * default), 2 (writing) or 8 (appending), and
+ * `CreateTextFile(path[, overwrite])`, told apart by the method name.
+ */
+AST* AST_Object_FileSystemObject_OpenTextFile::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    std::string path;
+    int mode = AST_Object_TextStream::ForReading;
+    bool flag = this->name == "createtextfile";
+
+    try {
+        path = anything_to_string(interpreter->visit(args[0]));
+
+        if (args.size() >= 2 && flag)
+            flag = anything_to_int(interpreter->visit(args[1])) != 0;
+        else if (args.size() >= 2)
+            mode = anything_to_int(interpreter->visit(args[1]));
+
+        if (args.size() >= 3 && !flag)
+            flag = anything_to_int(interpreter->visit(args[2])) != 0;
+    } catch (std::runtime_error& e) {
+        interpreter->error(this->name + ": " + e.what());
+    }
+
+    int flags = O_CLOEXEC;
+
+    if (this->name == "createtextfile") {
+        mode = AST_Object_TextStream::ForWriting;
+        flags |= O_WRONLY | O_CREAT | O_TRUNC | (flag ? 0 : O_EXCL);
+    } else if (mode == AST_Object_TextStream::ForReading) {
+        flags |= O_RDONLY;
+    } else if (mode == AST_Object_TextStream::ForWriting) {
+        flags |= O_WRONLY | O_TRUNC | (flag ? O_CREAT : 0);
+    } else if (mode == AST_Object_TextStream::ForAppending) {
+        flags |= O_WRONLY | O_APPEND | (flag ? O_CREAT : 0);
+    } else {
+        interpreter->error(this->name + ": Invalid procedure call or argument");
+    }
+
+    int fd = open(path.c_str(), flags, 0666);
+
+    if (fd < 0 && errno == ENOENT)
+        interpreter->error(this->name + ": File not found: " + path);
+    else if (fd < 0 && errno == EEXIST)
+        interpreter->error(this->name + ": File already exists: " + path);
+    else if (fd < 0)
+        interpreter->error(this->name + ": " + strerror(errno) + ": " + path);
+
+    return new AST_Object_TextStream(fd, (AST_Object_TextStream::IOMode)mode);
+};
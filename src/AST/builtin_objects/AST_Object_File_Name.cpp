@@ -0,0 +1,22 @@
+#include "../../includes/AST/builtin_objects/AST_Object_File_Name.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_File.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_File_Name::AST_Object_File_Name(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_File_Name::~AST_Object_File_Name() {};
+
+/**
+ * `Name` and `Path` of files and folders, told apart by the method name.
+ */
+AST* AST_Object_File_Name::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_File* file = (AST_Object_File*)self;
+
+    if (this->name == "path")
+        return new AST_Value(file->path);
+
+    return new AST_Value(file->name());
+};
@@ -0,0 +1,24 @@
+#include "../../includes/AST/builtin_objects/AST_Object_File_Size.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_File.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+#include <limits.h>
+
+
+AST_Object_File_Size::AST_Object_File_Size(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_File_Size::~AST_Object_File_Size() {};
+
+AST* AST_Object_File_Size::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_File* file = (AST_Object_File*)self;
+    struct stat* info = file->attributes();
+
+    if (info == nullptr)
+        interpreter->error(this->name + ": File not found: " + file->path);
+
+    if (info->st_size > INT_MAX)
+        return new AST_Value((float)info->st_size);
+
+    return new AST_Value((int)info->st_size);
+};
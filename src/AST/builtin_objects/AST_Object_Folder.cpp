@@ -0,0 +1,32 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Folder.hpp"
+
+
+AST_Object_Folder::AST_Object_Folder(std::string path) : AST_Object_File(path) {
+};
+
+AST_Object_Folder::~AST_Object_Folder() {};
+
+MethodTable* AST_Object_Folder::get_method_table() {
+    return AST_Object_Folder::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("Folder");
+
+    table->define(new AST_Object_File_Name("name"));
+    table->define(new AST_Object_File_Name("path"));
+    table->define(new AST_Object_Folder_Items("files"));
+    table->define(new AST_Object_Folder_Items("subfolders"));
+    table->define(new AST_Object_Folder_Items("walk"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all folders.
+ */
+MethodTable* AST_Object_Folder::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
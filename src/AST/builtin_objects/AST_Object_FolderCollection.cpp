@@ -0,0 +1,126 @@
+#include "../../includes/AST/builtin_objects/AST_Object_FolderCollection.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Folder.hpp"
+
+
+AST_Object_FolderCollection::AST_Object_FolderCollection(std::string path, Kind kind, int threads) : AST_Array(nullptr) {
+    this->path = path;
+    this->kind = kind;
+    this->threads = threads;
+    this->materialized = false;
+    this->reader = nullptr;
+    this->walker = nullptr;
+};
+
+AST_Object_FolderCollection::~AST_Object_FolderCollection() {
+    delete this->reader;
+    delete this->walker;
+};
+
+void AST_Object_FolderCollection::restart() {
+    delete this->reader;
+    delete this->walker;
+    this->reader = nullptr;
+    this->walker = nullptr;
+
+    if (this->kind == Walk)
+        this->walker = new DirectoryWalker(this->path, this->threads);
+    else
+        this->reader = new DirectoryReader(this->path);
+};
+
+AST* AST_Object_FolderCollection::read() {
+    DirectoryEntry entry;
+    std::string directory;
+
+    while (true) {
+        if (this->walker != nullptr) {
+            if (!this->walker->next(directory, entry))
+                break;
+        } else {
+            if (!this->reader->next(entry))
+                break;
+
+            if (entry.directory != (this->kind == SubFolders))
+                continue;
+
+            directory = this->path;
+        }
+
+        std::string path = directory;
+
+        if (path.empty() || path[path.size() - 1] != '/')
+            path += '/';
+
+        path += entry.name;
+
+        if (entry.directory)
+            return new AST_Object_Folder(path);
+
+        return new AST_Object_File(path);
+    }
+
+    delete this->reader;
+    delete this->walker;
+    this->reader = nullptr;
+    this->walker = nullptr;
+
+    return nullptr;
+};
+
+void AST_Object_FolderCollection::materialize() {
+    if (this->materialized)
+        return;
+
+    this->restart();
+
+    while (AST* item = this->read())
+        this->items.push_back(item);
+
+    this->materialized = true;
+};
+
+size_t AST_Object_FolderCollection::size() {
+    this->materialize();
+
+    return this->items.size();
+};
+
+anything AST_Object_FolderCollection::get(int offset) {
+    this->materialize();
+
+    return this->items[offset];
+};
+
+void AST_Object_FolderCollection::set(int offset, anything value) {
+    this->materialize();
+    AST_Array::set(offset, value);
+};
+
+void AST_Object_FolderCollection::redim(std::vector<int> dimensions, bool preserve) {
+    this->materialize();
+    AST_Array::redim(dimensions, preserve);
+};
+
+bool AST_Object_FolderCollection::next(size_t& cursor, anything& value) {
+    if (this->materialized)
+        return AST_Array::next(cursor, value);
+
+    if (cursor == 0)
+        this->restart();
+
+    AST* item = this->read();
+
+    if (item == nullptr)
+        return false;
+
+    value = item;
+    cursor++;
+
+    return true;
+};
+
+const double* AST_Object_FolderCollection::numeric_data(std::vector<double>& scratch, bool& integral) {
+    this->materialize();
+
+    return AST_Array::numeric_data(scratch, integral);
+};
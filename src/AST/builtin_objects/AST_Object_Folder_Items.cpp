@@ -0,0 +1,40 @@
+#include "../../includes/AST/builtin_objects/AST_Object_Folder_Items.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_Folder.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_FolderCollection.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_Folder_Items::AST_Object_Folder_Items(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_Folder_Items::~AST_Object_Folder_Items() {};
+
+/**
+ * `Files`, `SubFolders` and `Walk([threads])`, told apart by the method
+ * name. `Walk` returns every file and folder below the folder, listed
+ * by `threads` worker threads (none by default).
+ */
+AST* AST_Object_Folder_Items::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_Folder* folder = (AST_Object_Folder*)self;
+
+    if (this->name == "files")
+        return new AST_Object_FolderCollection(folder->path, AST_Object_FolderCollection::Files, 0);
+
+    if (this->name == "subfolders")
+        return new AST_Object_FolderCollection(folder->path, AST_Object_FolderCollection::SubFolders, 0);
+
+    int threads = 0;
+
+    try {
+        if (args.size() >= 1)
+            threads = anything_to_int(interpreter->visit(args[0]));
+    } catch (std::runtime_error& e) {
+        interpreter->error(this->name + ": " + e.what());
+    }
+
+    if (threads < 0 || threads > 256)
+        interpreter->error(this->name + ": Invalid procedure call or argument");
+
+    return new AST_Object_FolderCollection(folder->path, AST_Object_FolderCollection::Walk, threads);
+};
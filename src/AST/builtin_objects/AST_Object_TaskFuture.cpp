@@ -0,0 +1,65 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TaskFuture.hpp"
+#include "../../includes/Interpreter.hpp"
+
+
+AST_Object_TaskFuture::AST_Object_TaskFuture(TaskPool::Task* task) : AST_Object(nullptr) {
+    this->task = task;
+};
+
+AST_Object_TaskFuture::~AST_Object_TaskFuture() {};
+
+/**
+ * Sink for the task's buffers, see Output.
+ */
+static void forward(void* data, const char* buffer, size_t size) {
+    ((Output*)data)->write(buffer, size);
+};
+
+/**
+ * Hands what `from` holds on to `to` and frees it.
+ */
+static void emit(Output* from, Output* to) {
+    from->sink = forward;
+    from->sink_data = to;
+
+    delete from;
+
+    if (to->policy == Output::Line)
+        to->flush();
+};
+
+void AST_Object_TaskFuture::join(Interpreter* interpreter) {
+    TaskPool::instance()->wait(this->task);
+
+    if (this->task->emitted.exchange(true))
+        return;
+
+    emit(this->task->output, interpreter->context->output);
+    emit(this->task->errors, interpreter->context->error_output());
+
+    this->task->output = nullptr;
+    this->task->errors = nullptr;
+};
+
+MethodTable* AST_Object_TaskFuture::get_method_table() {
+    return AST_Object_TaskFuture::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("WScript.TaskFuture");
+
+    table->define(new AST_Object_TaskFuture_Wait("wait"));
+    table->define(new AST_Object_TaskFuture_Wait("result"));
+    table->define(new AST_Object_TaskFuture_Wait("done"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all futures.
+ */
+MethodTable* AST_Object_TaskFuture::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
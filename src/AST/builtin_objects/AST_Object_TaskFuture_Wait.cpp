@@ -0,0 +1,31 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TaskFuture_Wait.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TaskFuture.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TaskFuture_Wait::AST_Object_TaskFuture_Wait(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TaskFuture_Wait::~AST_Object_TaskFuture_Wait() {};
+
+/**
+ * `Wait`, `Result` and `Done`, told apart by the method name. Only
+ * `Result` fails when the task failed.
+ */
+AST* AST_Object_TaskFuture_Wait::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TaskFuture* future = (AST_Object_TaskFuture*)self;
+
+    if (this->name == "done")
+        return new AST_Value((int)TaskPool::instance()->done(future->task));
+
+    future->join(interpreter);
+
+    if (this->name == "wait")
+        return new AST_Value(0);
+
+    if (!future->task->error.empty())
+        interpreter->error("Task `" + future->task->definition->name + "` failed: " + future->task->error);
+
+    return new AST_Value(future->task->result);
+};
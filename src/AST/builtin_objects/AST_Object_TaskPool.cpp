@@ -0,0 +1,29 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TaskPool.hpp"
+
+
+AST_Object_TaskPool::AST_Object_TaskPool(Token* token) : AST_Object(token) {
+};
+
+AST_Object_TaskPool::~AST_Object_TaskPool() {};
+
+MethodTable* AST_Object_TaskPool::get_method_table() {
+    return AST_Object_TaskPool::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("WScript.TaskPool");
+
+    table->define(new AST_Object_TaskPool_Submit("submit"));
+    table->define(new AST_Object_TaskPool_WaitAll("waitall"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all pools.
+ */
+MethodTable* AST_Object_TaskPool::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
@@ -0,0 +1,80 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TaskPool_Submit.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TaskPool.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/typedefs.hpp"
+#include <ctype.h>
+
+
+AST_Object_TaskPool_Submit::AST_Object_TaskPool_Submit(std::string name) : AST_BuiltinMethodDefinition(name) {
+    this->expected_args.push_back(TokenType::String);
+    this->unlimited_args = true;
+};
+
+AST_Object_TaskPool_Submit::~AST_Object_TaskPool_Submit() {};
+
+/**
+ * `Submit(name, args...)` runs the global function `name` with `args`
+ * on the pool, the arguments are evaluated here. Objects are copied for
+ * the task or refused (see ExecutionContext::share), a task never uses
+ * a dictionary or instance of the script that submitted it.
+ *
+ * @return AST* - a WScript.TaskFuture.
+ */
+AST* AST_Object_TaskPool_Submit::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TaskPool* pool = (AST_Object_TaskPool*)self;
+
+    if (interpreter->program == nullptr)
+        interpreter->error(this->name + ": Tasks need a compiled Program");
+
+    std::string name = anything_to_string(interpreter->visit(args[0]));
+
+    for (size_t i = 0; i < name.size(); i++)
+        name[i] = tolower(name[i]);
+
+    AST_FunctionDefinition* definition = interpreter->context->globals->get_function_definition(name);
+
+    if (definition == nullptr)
+        interpreter->error(this->name + ": Could not find definition for: " + name);
+
+    if (definition->args.size() != args.size() - 1)
+        interpreter->error(this->name + ": Wrong number of arguments when calling: " + name);
+
+    TaskPool::Task* task = new TaskPool::Task();
+    task->program = interpreter->program;
+    task->definition = definition;
+    task->output = new Output(-1, Output::Exit);
+    task->errors = new Output(-1, Output::Exit);
+    task->emitted.store(false);
+
+    for (size_t i = 1; i < args.size(); i++)
+        task->args.push_back(interpreter->stored(interpreter->visit(args[i])));
+
+    std::string refused;
+
+    try {
+        task->snapshot = interpreter->context->snapshot();
+
+        for (size_t i = 0; refused.empty() && i < task->args.size(); i++)
+            if (!interpreter->context->share(task->args[i], *task->snapshot))
+                refused = "argument " + std::to_string(i + 1) + " holds an object a task can not use";
+    } catch (std::runtime_error& e) {
+        task->snapshot = nullptr;
+        refused = e.what();
+    }
+
+    if (!refused.empty()) {
+        delete task->snapshot;
+        delete task->output;
+        delete task->errors;
+        delete task;
+
+        interpreter->error(this->name + ": " + refused);
+    }
+
+    AST_Object_TaskFuture* future = new AST_Object_TaskFuture(task);
+    pool->futures.push_back(future);
+
+    TaskPool::instance()->submit(task);
+
+    return future;
+};
@@ -0,0 +1,25 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TaskPool_WaitAll.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TaskPool.hpp"
+#include "../../includes/AST/AST_Value.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TaskPool_WaitAll::AST_Object_TaskPool_WaitAll(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TaskPool_WaitAll::~AST_Object_TaskPool_WaitAll() {};
+
+/**
+ * Waits for every task submitted to the pool, their output is written
+ * in the order they were submitted.
+ */
+AST* AST_Object_TaskPool_WaitAll::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TaskPool* pool = (AST_Object_TaskPool*)self;
+
+    for (size_t i = 0; i < pool->futures.size(); i++)
+        pool->futures[i]->join(interpreter);
+
+    pool->futures.clear();
+
+    return new AST_Value(0);
+};
@@ -0,0 +1,99 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include <unistd.h>
+
+
+AST_Object_TextStream::AST_Object_TextStream(int fd, IOMode mode) : AST_Object(nullptr) {
+    this->fd = fd;
+    this->mode = mode;
+    this->input = nullptr;
+    this->output = nullptr;
+    this->closed = false;
+    this->line = new AST_Value(std::string());
+    this->status = new AST_Value(0);
+
+    if (mode == ForReading)
+        this->input = new Input(fd);
+    else
+        this->output = new Output(fd, Output::Full);
+};
+
+AST_Object_TextStream::AST_Object_TextStream(Input* input, Output* output) : AST_Object(nullptr) {
+    this->fd = -1;
+    this->mode = input != nullptr ? ForReading : ForAppending;
+    this->input = input;
+    this->output = output;
+    this->closed = false;
+    this->line = new AST_Value(std::string());
+    this->status = new AST_Value(0);
+};
+
+AST_Object_TextStream::~AST_Object_TextStream() {
+    this->close();
+
+    delete this->line;
+    delete this->status;
+};
+
+Input* AST_Object_TextStream::reader() {
+    return this->closed ? nullptr : this->input;
+};
+
+Output* AST_Object_TextStream::writer() {
+    return this->closed ? nullptr : this->output;
+};
+
+AST_Value* AST_Object_TextStream::result(int value) {
+    this->status->value = value;
+
+    return this->status;
+};
+
+void AST_Object_TextStream::close() {
+    if (this->closed)
+        return;
+
+    // standard streams stay usable for print and WScript.Echo
+    if (this->fd < 0) {
+        if (this->output != nullptr)
+            this->output->flush();
+
+        this->closed = true;
+
+        return;
+    }
+
+    delete this->input;
+    delete this->output;
+    this->input = nullptr;
+    this->output = nullptr;
+
+    ::close(this->fd);
+    this->closed = true;
+};
+
+MethodTable* AST_Object_TextStream::get_method_table() {
+    return AST_Object_TextStream::methods();
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("TextStream");
+
+    table->define(new AST_Object_TextStream_Read("readline"));
+    table->define(new AST_Object_TextStream_Read("readall"));
+    table->define(new AST_Object_TextStream_Read("skipline"));
+    table->define(new AST_Object_TextStream_Write("write"));
+    table->define(new AST_Object_TextStream_Write("writeline"));
+    table->define(new AST_Object_TextStream_AtEndOfStream("atendofstream"));
+    table->define(new AST_Object_TextStream_Close("close"));
+
+    return table;
+};
+
+/**
+ * @return MethodTable* - created on first use, shared by all streams.
+ */
+MethodTable* AST_Object_TextStream::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
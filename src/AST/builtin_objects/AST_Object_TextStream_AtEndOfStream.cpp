@@ -0,0 +1,20 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream_AtEndOfStream.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TextStream_AtEndOfStream::AST_Object_TextStream_AtEndOfStream(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TextStream_AtEndOfStream::~AST_Object_TextStream_AtEndOfStream() {};
+
+AST* AST_Object_TextStream_AtEndOfStream::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TextStream* stream = (AST_Object_TextStream*)self;
+    Input* input = stream->reader();
+
+    if (input == nullptr)
+        interpreter->error(this->name + ": Bad file mode");
+
+    // TODO: return AST_Boolean
+    return stream->result(input->at_end());
+};
@@ -0,0 +1,16 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream_Close.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TextStream_Close::AST_Object_TextStream_Close(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TextStream_Close::~AST_Object_TextStream_Close() {};
+
+AST* AST_Object_TextStream_Close::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TextStream* stream = (AST_Object_TextStream*)self;
+    stream->close();
+
+    return stream->result(0);
+};
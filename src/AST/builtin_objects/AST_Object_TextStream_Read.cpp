@@ -0,0 +1,41 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream_Read.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TextStream_Read::AST_Object_TextStream_Read(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TextStream_Read::~AST_Object_TextStream_Read() {};
+
+/**
+ * `ReadLine`, `ReadAll` and `SkipLine`, told apart by the method name.
+ */
+AST* AST_Object_TextStream_Read::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TextStream* stream = (AST_Object_TextStream*)self;
+    Input* input = stream->reader();
+
+    if (input == nullptr)
+        interpreter->error(this->name + ": Bad file mode");
+
+    std::string& value = boost::get<std::string>(stream->line->value);
+
+    // do not hold on to the buffer of a huge line or ReadAll
+    if (value.capacity() > Input::BUFFER_SIZE)
+        std::string().swap(value);
+
+    if (this->name == "readall") {
+        value.clear();
+        input->read_all(value);
+
+        return stream->line;
+    }
+
+    if (!input->read_line(value))
+        interpreter->error(this->name + ": Input past end of file");
+
+    if (this->name == "skipline")
+        return stream->result(0);
+
+    return stream->line;
+};
@@ -0,0 +1,32 @@
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream_Write.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/AST/AST_TypedArray.hpp"
+#include "../../includes/typedefs.hpp"
+
+
+AST_Object_TextStream_Write::AST_Object_TextStream_Write(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_Object_TextStream_Write::~AST_Object_TextStream_Write() {};
+
+/**
+ * `Write(text)` and `WriteLine([text])`, told apart by the method name.
+ */
+AST* AST_Object_TextStream_Write::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    AST_Object_TextStream* stream = (AST_Object_TextStream*)self;
+    Output* output = stream->writer();
+
+    if (output == nullptr)
+        interpreter->error(this->name + ": Bad file mode");
+
+    if (args.size() == 0 && this->name == "write")
+        interpreter->error("Missing 1 arguments when calling: write");
+
+    if (args.size() > 0)
+        output->write(anything_to_string(interpreter->visit(args[0])));
+
+    if (this->name == "writeline")
+        output->newline();
+
+    return stream->result(0);
+};
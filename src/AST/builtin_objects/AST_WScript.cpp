@@ -1,9 +1,38 @@
 #include "../../includes/AST/builtin_objects/AST_WScript.hpp"
-#include "../../includes/Scope.hpp"
 
 
-AST_WScript::AST_WScript(Token* token) : AST_Object(token) {
-    this->private_scope->define_builtin_function(new AST_WScript_Echo("echo"));
-};
+AST_WScript::AST_WScript(Token* token) : AST_Object(token) {};
 
 AST_WScript::~AST_WScript() {};
+
+MethodTable* AST_WScript::get_method_table() {
+    return AST_WScript::methods();
+};
+
+/**
+ * Every `WScript` in a script refers to this object.
+ *
+ * @return AST_WScript*
+ */
+AST_WScript* AST_WScript::instance() {
+    static AST_WScript* wscript = new AST_WScript(nullptr);
+
+    return wscript;
+};
+
+static MethodTable* create_methods() {
+    MethodTable* table = new MethodTable("WScript");
+
+    table->define(new AST_WScript_Echo("echo"));
+    table->define(new AST_WScript_Stream("stdin"));
+    table->define(new AST_WScript_Stream("stdout"));
+    table->define(new AST_WScript_Stream("stderr"));
+
+    return table;
+};
+
+MethodTable* AST_WScript::methods() {
+    static MethodTable* table = create_methods();
+
+    return table;
+};
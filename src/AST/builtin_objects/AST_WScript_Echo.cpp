@@ -2,7 +2,7 @@
 #include "../../includes/typedefs.hpp"
 
 
-AST_WScript_Echo::AST_WScript_Echo(std::string name) : AST_BuiltinFunctionDefinition(name) {
+AST_WScript_Echo::AST_WScript_Echo(std::string name) : AST_BuiltinMethodDefinition(name) {
     this->unlimited_args = true;
 };
 
@@ -10,7 +10,7 @@ AST_WScript_Echo::~AST_WScript_Echo() {
     this->expected_args.clear();
 };
 
-AST* AST_WScript_Echo::call(std::vector<AST*> args, Interpreter* interpreter) {
+AST* AST_WScript_Echo::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
     if (args.size()) {
         for (
                 std::vector<AST*>::iterator it = args.begin();
@@ -19,7 +19,7 @@ AST* AST_WScript_Echo::call(std::vector<AST*> args, Interpreter* interpreter) {
             ) {
 
             anything x = interpreter->visit((*it));
-            coutprint(x);
+            coutprint(interpreter->context->output, x);
         }
     }
 
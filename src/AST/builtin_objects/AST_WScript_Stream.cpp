@@ -0,0 +1,24 @@
+#include "../../includes/AST/builtin_objects/AST_WScript_Stream.hpp"
+#include "../../includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "../../includes/Interpreter.hpp"
+#include <unistd.h>
+
+
+AST_WScript_Stream::AST_WScript_Stream(std::string name) : AST_BuiltinMethodDefinition(name) {
+};
+
+AST_WScript_Stream::~AST_WScript_Stream() {};
+
+/**
+ * `WScript.StdIn`, `WScript.StdOut` and `WScript.StdErr`, told apart by
+ * the method name.
+ */
+AST* AST_WScript_Stream::call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) {
+    if (this->name == "stdin")
+        return interpreter->context->stream(STDIN_FILENO);
+
+    if (this->name == "stdout")
+        return interpreter->context->stream(STDOUT_FILENO);
+
+    return interpreter->context->stream(STDERR_FILENO);
+};
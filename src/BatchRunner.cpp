@@ -0,0 +1,290 @@
+#include "includes/BatchRunner.hpp"
+#include "includes/Interpreter.hpp"
+#include "includes/ExecutionContext.hpp"
+#include "includes/Input.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+
+const size_t BatchRunner::MAX_PENDING;
+
+
+BatchRunner::BatchRunner(std::string path, int threads) {
+    this->path = path;
+    this->threads = threads > 0 ? threads : std::max(1, (int)std::thread::hardware_concurrency());
+    this->emitted.store(0);
+};
+
+/**
+ * Programs are kept, freeing an AST is not supported.
+ */
+BatchRunner::~BatchRunner() {
+    for (size_t i = 0; i < this->queues.size(); i++)
+        delete this->queues[i];
+
+    for (std::map<std::string, CachedProgram*>::iterator it = this->programs.begin(); it != this->programs.end(); ++it)
+        delete it->second;
+};
+
+bool BatchRunner::read_jobs(const std::string& path, std::vector<std::string>& jobs, std::string& error) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0) {
+        error = "cannot open " + path + ": " + strerror(errno);
+
+        return false;
+    }
+
+    Input input(fd);
+    std::string line;
+
+    while (input.read_line(line))
+        if (!line.empty())
+            jobs.push_back(line);
+
+    close(fd);
+
+    return true;
+};
+
+Program* BatchRunner::parse_file(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + path + ": " + strerror(errno));
+
+    std::string source;
+    Input input(fd);
+    input.read_all(source);
+    close(fd);
+
+    return new Program(source);
+};
+
+int BatchRunner::run() {
+    std::vector<std::string> paths;
+    std::string error;
+
+    if (!BatchRunner::read_jobs(this->path, paths, error)) {
+        std::cerr << error << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        Job job;
+        job.path = paths[i];
+        job.output = nullptr;
+        job.error = nullptr;
+        job.done = false;
+        job.failed = false;
+        job.nanoseconds = 0;
+
+        this->jobs.push_back(job);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < this->threads; i++)
+        this->queues.push_back(new Queue());
+
+    for (size_t i = 0; i < this->jobs.size(); i++)
+        this->queues[i % this->threads]->jobs.push_back(i);
+
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < this->threads; i++)
+        workers.push_back(std::thread(&BatchRunner::work, this, (size_t)i));
+
+    int status = EXIT_SUCCESS;
+
+    for (size_t i = 0; i < this->jobs.size(); i++) {
+        Job& job = this->jobs[i];
+
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+
+            while (!job.done)
+                this->finished.wait(guard);
+        }
+
+        this->emit(job);
+
+        if (job.failed)
+            status = EXIT_FAILURE;
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->emitted.store(i + 1);
+        }
+
+        this->progress.notify_all();
+    }
+
+    for (size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    std::vector<long> latencies;
+    size_t failed = 0;
+
+    for (size_t i = 0; i < this->jobs.size(); i++) {
+        latencies.push_back(this->jobs[i].nanoseconds);
+
+        if (this->jobs[i].failed)
+            failed++;
+    }
+
+    BatchRunner::report(latencies, failed, std::to_string(this->threads) + " threads", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    return status;
+};
+
+void BatchRunner::work(size_t worker) {
+    size_t job;
+
+    while (true) {
+        size_t emitted = this->emitted.load();
+        Take taken = this->take(worker, emitted + MAX_PENDING, job);
+
+        if (taken == Empty)
+            return;
+
+        if (taken == Taken) {
+            this->run_job(this->jobs[job]);
+            continue;
+        }
+
+        // everything left is too far ahead of the output, wait for it to move
+        std::unique_lock<std::mutex> guard(this->lock);
+
+        while (this->emitted.load() == emitted)
+            this->progress.wait(guard);
+    }
+};
+
+/**
+ * The worker's own queue is taken from the front, the others are stolen
+ * from at the back, or at the front if the back is too far ahead.
+ * The next job to be written is always at the front of a queue or
+ * already running, so some worker can always make progress.
+ *
+ * @param size_t limit - jobs from here on have to wait.
+ *
+ * @return Take - Blocked if jobs are left but none is below `limit`.
+ */
+BatchRunner::Take BatchRunner::take(size_t worker, size_t limit, size_t& job) {
+    bool blocked = false;
+
+    for (size_t i = 0; i < this->queues.size(); i++) {
+        Queue* queue = this->queues[(worker + i) % this->queues.size()];
+        std::lock_guard<std::mutex> guard(queue->lock);
+
+        if (queue->jobs.empty())
+            continue;
+
+        if (i > 0 && queue->jobs.back() < limit) {
+            job = queue->jobs.back();
+            queue->jobs.pop_back();
+
+            return Taken;
+        }
+
+        if (queue->jobs.front() < limit) {
+            job = queue->jobs.front();
+            queue->jobs.pop_front();
+
+            return Taken;
+        }
+
+        blocked = true;
+    }
+
+    return blocked ? Blocked : Empty;
+};
+
+void BatchRunner::run_job(Job& job) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    job.output = new Output(-1, Output::Exit);
+    job.error = new Output(-1, Output::Exit);
+
+    try {
+        Program* program = this->compile(job.path);
+        ExecutionContext context(job.output, job.error);
+        Interpreter interpreter(program, &context);
+
+        interpreter.interpret();
+    } catch (std::exception& e) {
+        job.error->write(job.path + ": " + e.what());
+        job.error->newline();
+        job.failed = true;
+    }
+
+    job.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        job.done = true;
+    }
+
+    this->finished.notify_one();
+};
+
+Program* BatchRunner::compile(const std::string& path) {
+    CachedProgram* cached;
+
+    {
+        std::lock_guard<std::mutex> guard(this->programs_lock);
+        CachedProgram*& entry = this->programs[path];
+
+        if (entry == nullptr) {
+            entry = new CachedProgram();
+            entry->program = nullptr;
+        }
+
+        cached = entry;
+    }
+
+    // other jobs of the same script wait here while it is parsed
+    std::call_once(cached->once, [cached, &path]() {
+        try {
+            cached->program = BatchRunner::parse_file(path);
+        } catch (std::exception& e) {
+            cached->error = e.what();
+        }
+    });
+
+    if (cached->program == nullptr)
+        throw std::runtime_error(cached->error);
+
+    return cached->program;
+};
+
+void BatchRunner::emit(Job& job) {
+    job.output->fd = STDOUT_FILENO;
+    job.output->flush();
+    delete job.output;
+    job.output = nullptr;
+
+    job.error->fd = STDERR_FILENO;
+    job.error->flush();
+    delete job.error;
+    job.error = nullptr;
+};
+
+void BatchRunner::report(std::vector<long> latencies, size_t failed, std::string workers, double seconds) {
+    std::sort(latencies.begin(), latencies.end());
+
+    long p50 = latencies.empty() ? 0 : latencies[(latencies.size() - 1) / 2];
+    long p99 = latencies.empty() ? 0 : latencies[(latencies.size() * 99 + 99) / 100 - 1];
+
+    std::cerr << "batch: " << latencies.size() << " jobs, " << failed << " failed, "
+        << workers << ", " << (long)(seconds * 1000) << "ms, "
+        << (long)(seconds > 0 ? latencies.size() / seconds : 0) << " jobs/s, "
+        << "p50 " << p50 / 1000 << "us, p99 " << p99 / 1000 << "us" << std::endl;
+};
@@ -0,0 +1,60 @@
+#include "includes/Client.hpp"
+#include "includes/ServerProtocol.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <iostream>
+
+
+int Client::run(std::string path, std::vector<std::string> args) {
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "socket path too long: " << path << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    strcpy(address.sun_path, path.c_str());
+
+    int server = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (server < 0 || connect(server, (struct sockaddr*)&address, sizeof(address)) != 0) {
+        std::cerr << "cannot connect to " << path << ": " << strerror(errno) << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    char cwd[PATH_MAX];
+    ServerRequest request;
+
+    if (getcwd(cwd, sizeof(cwd)) == nullptr) {
+        std::cerr << "cannot determine the working directory: " << strerror(errno) << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    request.cwd = cwd;
+    request.args = args;
+
+    for (int i = 0; i < 3; i++)
+        request.fds[i] = i;
+
+    int status;
+
+    if (!send_request(server, request) || !receive_status(server, status)) {
+        std::cerr << "lost the connection to " << path << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    close(server);
+
+    return status;
+};
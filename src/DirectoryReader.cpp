@@ -0,0 +1,133 @@
+#include "includes/DirectoryReader.hpp"
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <dirent.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+const size_t DirectoryReader::BUFFER_SIZE;
+
+
+DirectoryReader::DirectoryReader(const std::string& path) {
+    this->path = path;
+    this->error = 0;
+    this->fd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (this->fd < 0)
+        this->error = errno;
+
+#ifdef __linux__
+    this->buffer = nullptr;
+    this->offset = 0;
+    this->length = 0;
+#else
+    this->dir = this->fd < 0 ? nullptr : fdopendir(this->fd);
+#endif
+};
+
+DirectoryReader::~DirectoryReader() {
+#ifdef __linux__
+    delete[] this->buffer;
+
+    if (this->fd >= 0)
+        close(this->fd);
+#else
+    if (this->dir != nullptr)
+        closedir(this->dir);
+    else if (this->fd >= 0)
+        close(this->fd);
+#endif
+};
+
+void DirectoryReader::classify(DirectoryEntry& entry, unsigned char type) {
+    if (type == DT_DIR || type == DT_REG) {
+        entry.directory = type == DT_DIR;
+        entry.link = false;
+    } else if (type == DT_LNK || type == DT_UNKNOWN) {
+        this->resolve(entry, type == DT_LNK);
+    } else {
+        entry.directory = false;
+        entry.link = false;
+    }
+};
+
+void DirectoryReader::resolve(DirectoryEntry& entry, bool link) {
+    struct stat info;
+
+    entry.link = link;
+    entry.directory = fstatat(this->fd, entry.name.c_str(), &info, 0) == 0 && S_ISDIR(info.st_mode);
+
+    if (!link && fstatat(this->fd, entry.name.c_str(), &info, AT_SYMLINK_NOFOLLOW) == 0)
+        entry.link = S_ISLNK(info.st_mode);
+};
+
+static bool is_dot_or_dot_dot(const char* name) {
+    return name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+};
+
+#ifdef __linux__
+bool DirectoryReader::next(DirectoryEntry& entry) {
+    if (this->fd < 0)
+        return false;
+
+    while (true) {
+        if (this->offset >= this->length) {
+            if (this->buffer == nullptr)
+                this->buffer = new char[BUFFER_SIZE];
+
+            long n;
+
+            do {
+                n = syscall(SYS_getdents64, this->fd, this->buffer, BUFFER_SIZE);
+            } while (n < 0 && errno == EINTR);
+
+            if (n <= 0)
+                return false;
+
+            this->offset = 0;
+            this->length = n;
+        }
+
+        linux_dirent64* dirent = (linux_dirent64*)(this->buffer + this->offset);
+        this->offset += dirent->d_reclen;
+
+        if (is_dot_or_dot_dot(dirent->d_name))
+            continue;
+
+        entry.name.assign(dirent->d_name);
+        this->classify(entry, dirent->d_type);
+
+        return true;
+    }
+};
+#else
+bool DirectoryReader::next(DirectoryEntry& entry) {
+    if (this->dir == nullptr)
+        return false;
+
+    while (struct dirent* dirent = readdir(this->dir)) {
+        if (is_dot_or_dot_dot(dirent->d_name))
+            continue;
+
+        entry.name.assign(dirent->d_name);
+        this->classify(entry, dirent->d_type);
+
+        return true;
+    }
+
+    return false;
+};
+#endif
@@ -0,0 +1,165 @@
+#include "includes/DirectoryWalker.hpp"
+#include <algorithm>
+
+const size_t DirectoryWalker::MAX_BUFFERED;
+
+
+DirectoryWalker::DirectoryWalker(const std::string& root, int threads) {
+    this->buffered = 0;
+    this->stopping = false;
+
+    Listing* listing = new Listing();
+    listing->path = root;
+    listing->state = Listing::Queued;
+
+    this->queue.push_back(listing);
+    this->stack.push_back(Frame{ listing, false, 0, 0 });
+
+    for (int i = 0; i < threads; i++)
+        this->workers.push_back(std::thread(&DirectoryWalker::run, this));
+};
+
+DirectoryWalker::~DirectoryWalker() {
+    this->stop();
+
+    for (size_t i = 0; i < this->stack.size(); i++) {
+        Frame& frame = this->stack[i];
+
+        for (size_t j = frame.child; j < frame.listing->children.size(); j++)
+            release(frame.listing->children[j]);
+
+        delete frame.listing;
+    }
+};
+
+void DirectoryWalker::release(Listing* listing) {
+    for (size_t i = 0; i < listing->children.size(); i++)
+        release(listing->children[i]);
+
+    delete listing;
+};
+
+void DirectoryWalker::stop() {
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+    }
+
+    this->work.notify_all();
+
+    for (size_t i = 0; i < this->workers.size(); i++)
+        this->workers[i].join();
+
+    this->workers.clear();
+};
+
+/**
+ * Reads a directory without holding the lock and publishes the result.
+ */
+void DirectoryWalker::list(Listing* listing) {
+    DirectoryReader reader(listing->path);
+    std::vector<DirectoryEntry> entries;
+    std::vector<Listing*> children;
+    DirectoryEntry entry;
+
+    // unreadable subdirectories are returned as empty
+    while (reader.next(entry)) {
+        if (entry.directory && !entry.link) {
+            Listing* child = new Listing();
+            child->path = listing->path + "/" + entry.name;
+            child->state = Listing::Queued;
+            children.push_back(child);
+        }
+
+        entries.push_back(entry);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        listing->entries.swap(entries);
+        listing->children = children;
+        listing->state = Listing::Done;
+        this->buffered += listing->entries.size();
+
+        for (size_t i = children.size(); i > 0; i--)
+            this->queue.push_back(children[i - 1]);
+    }
+
+    this->listed.notify_all();
+
+    if (!children.empty())
+        this->work.notify_all();
+};
+
+void DirectoryWalker::wait(Listing* listing) {
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    if (listing->state == Listing::Queued) {
+        std::deque<Listing*>::reverse_iterator it = std::find(this->queue.rbegin(), this->queue.rend(), listing);
+        this->queue.erase(std::next(it).base());
+        listing->state = Listing::Running;
+        guard.unlock();
+
+        this->list(listing);
+        return;
+    }
+
+    while (listing->state != Listing::Done)
+        this->listed.wait(guard);
+};
+
+void DirectoryWalker::run() {
+    while (true) {
+        std::unique_lock<std::mutex> guard(this->lock);
+
+        while (!this->stopping && (this->queue.empty() || this->buffered >= MAX_BUFFERED))
+            this->work.wait(guard);
+
+        if (this->stopping)
+            return;
+
+        Listing* listing = this->queue.back();
+        this->queue.pop_back();
+        listing->state = Listing::Running;
+        guard.unlock();
+
+        this->list(listing);
+    }
+};
+
+bool DirectoryWalker::next(std::string& directory, DirectoryEntry& entry) {
+    while (!this->stack.empty()) {
+        Frame& frame = this->stack.back();
+
+        if (!frame.ready) {
+            this->wait(frame.listing);
+            frame.ready = true;
+        }
+
+        Listing* listing = frame.listing;
+
+        if (frame.index < listing->entries.size()) {
+            entry = listing->entries[frame.index++];
+            directory = listing->path;
+
+            if (entry.directory && !entry.link)
+                this->stack.push_back(Frame{ listing->children[frame.child++], false, 0, 0 });
+
+            return true;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->buffered -= listing->entries.size();
+        }
+
+        this->work.notify_one();
+        delete listing;
+        this->stack.pop_back();
+    }
+
+    this->stop();
+
+    return false;
+};
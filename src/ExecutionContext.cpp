@@ -0,0 +1,282 @@
+#include "includes/ExecutionContext.hpp"
+#include "includes/initialize_scope.hpp"
+#include "includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "includes/AST/AST_Array.hpp"
+#include "includes/AST/AST_ClassInstance.hpp"
+#include "includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "includes/AST/builtin_objects/AST_Object_Folder.hpp"
+#include "includes/AST/builtin_objects/AST_Object_FolderCollection.hpp"
+#include "includes/AST/builtin_objects/AST_Object_FileSystemObject.hpp"
+#include "includes/AST/builtin_objects/AST_Object_TaskPool.hpp"
+#include "includes/AST/builtin_objects/AST_Object_TaskFuture.hpp"
+#include "includes/AST/builtin_objects/AST_WScript.hpp"
+#include <unistd.h>
+
+
+ExecutionContext::ExecutionContext(Output* output) : ExecutionContext(output, nullptr) {};
+
+ExecutionContext::ExecutionContext(Output* output, Output* error) {
+    this->output = output;
+    this->error = error;
+    this->owns_error = false;
+    this->globals = new Scope("global");
+
+    initialize_scope(this->globals);
+
+    for (int fd = STDIN_FILENO; fd <= STDERR_FILENO; fd++)
+        this->streams[fd] = nullptr;
+};
+
+/**
+ * Values the script stored are not freed, like everywhere else.
+ */
+ExecutionContext::~ExecutionContext() {
+    this->close_streams();
+
+    if (this->owns_error)
+        delete this->error;
+
+    for (std::vector<Scope*>::iterator it = this->frames.begin(); it != this->frames.end(); ++it)
+        delete *it;
+
+    for (std::vector<AST_BuiltinFunctionDefinition*>::iterator it = this->globals->builtin_functions.begin(); it != this->globals->builtin_functions.end(); ++it)
+        delete *it;
+
+    delete this->globals;
+};
+
+void ExecutionContext::reset(Output* output, Output* error) {
+    this->close_streams();
+
+    if (this->owns_error)
+        delete this->error;
+
+    this->output = output;
+    this->error = error;
+    this->owns_error = false;
+
+    this->borrowed.clear();
+
+    clear_scope(this->globals);
+
+    for (std::vector<Scope*>::iterator it = this->frames.begin(); it != this->frames.end(); ++it)
+        if (*it != nullptr)
+            clear_scope(*it);
+};
+
+ExecutionContext::Snapshot* ExecutionContext::snapshot() {
+    Snapshot* snapshot = new Snapshot();
+    snapshot->variables = this->globals->variables;
+    snapshot->classes = this->globals->classes;
+    snapshot->functions.push_back(this->globals->function_definitions);
+
+    for (std::vector<Scope*>::iterator it = this->frames.begin(); it != this->frames.end(); ++it)
+        snapshot->functions.push_back(*it != nullptr ? (*it)->function_definitions : std::vector<AST_FunctionDefinition*>());
+
+    for (std::map<std::string, anything>::iterator it = snapshot->variables.begin(); it != snapshot->variables.end(); ++it) {
+        if (!this->share(it->second, *snapshot)) {
+            delete snapshot;
+
+            throw std::runtime_error("`" + it->first + "` holds an object a task can not use");
+        }
+    }
+
+    return snapshot;
+};
+
+/**
+ * Whether `value` is a scalar or Empty.
+ */
+static bool is_scalar(const anything& value) {
+    if (value.type() != typeid(AST*))
+        return true;
+
+    AST* ast = boost::get<AST*>(value);
+
+    return dynamic_cast<AST_Array*>(ast) == nullptr && dynamic_cast<AST_Object*>(ast) == nullptr;
+};
+
+bool ExecutionContext::share(anything& value, Snapshot& snapshot, bool nested) {
+    if (is_scalar(value))
+        return true;
+
+    AST* ast = boost::get<AST*>(value);
+    std::map<AST*, AST*>::iterator copied = snapshot.copies.find(ast);
+
+    if (copied != snapshot.copies.end()) {
+        value = copied->second;
+        return true;
+    }
+
+    if (AST_Array* array = dynamic_cast<AST_Array*>(ast)) {
+        // an element written through the array is not copied on write
+        bool shallow = !nested && dynamic_cast<AST_Object_FolderCollection*>(array) == nullptr;
+
+        for (size_t i = 0; shallow && array->get_element_type() == TokenType::Anything && i < array->size(); i++)
+            shallow = is_scalar(array->get(i));
+
+        if (shallow) {
+            snapshot.borrowed.insert(array);
+            this->borrowed.insert(array);
+
+            return true;
+        }
+
+        AST_Array* copy = array->copy();
+        snapshot.copies[array] = copy;
+        value = (AST*)copy;
+
+        for (size_t i = 0; copy->get_element_type() == TokenType::Anything && i < copy->size(); i++) {
+            anything element = copy->get(i);
+
+            if (!this->share(element, snapshot, true))
+                return false;
+
+            copy->set(i, element);
+        }
+
+        return true;
+    }
+
+    if (AST_Object_Dictionary* dict = dynamic_cast<AST_Object_Dictionary*>(ast)) {
+        AST_Object_Dictionary* copy = new AST_Object_Dictionary(nullptr);
+        copy->table = dict->table;
+        snapshot.copies[dict] = copy;
+        value = (AST*)copy;
+
+        for (std::vector<HashTable::Entry>::iterator it = copy->table.entries.begin(); it != copy->table.entries.end(); ++it) {
+            // object keys are hashed by address, they can not be copied
+            if (!it->removed && !is_scalar(it->key))
+                return false;
+
+            if (!it->removed && !this->share(it->value, snapshot, true))
+                return false;
+        }
+
+        return true;
+    }
+
+    if (AST_ClassInstance* instance = dynamic_cast<AST_ClassInstance*>(ast)) {
+        AST_ClassInstance* copy = new AST_ClassInstance(instance->definition);
+        copy->slots = instance->slots;
+        snapshot.copies[instance] = copy;
+        value = (AST*)copy;
+
+        for (size_t i = 0; i < copy->slots.size(); i++)
+            if (!this->share(copy->slots[i], snapshot, true))
+                return false;
+
+        return true;
+    }
+
+    AST* copy = nullptr;
+
+    // a task submits to and waits for a pool of its own
+    if (dynamic_cast<AST_Object_TaskPool*>(ast))
+        copy = new AST_Object_TaskPool(nullptr);
+    else if (AST_Object_Folder* folder = dynamic_cast<AST_Object_Folder*>(ast))
+        copy = new AST_Object_Folder(folder->path);
+    else if (AST_Object_File* file = dynamic_cast<AST_Object_File*>(ast))
+        copy = new AST_Object_File(file->path);
+
+    if (copy != nullptr) {
+        snapshot.copies[ast] = copy;
+        value = copy;
+
+        return true;
+    }
+
+    return dynamic_cast<AST_Object_FileSystemObject*>(ast) != nullptr
+        || dynamic_cast<AST_Object_TaskFuture*>(ast) != nullptr
+        || dynamic_cast<AST_WScript*>(ast) != nullptr;
+};
+
+void ExecutionContext::restore(const Snapshot& snapshot) {
+    this->globals->variables = snapshot.variables;
+    this->globals->classes = snapshot.classes;
+    this->globals->function_definitions = snapshot.functions[0];
+
+    for (size_t slot = 1; slot < snapshot.functions.size(); slot++) {
+        if (snapshot.functions[slot].empty())
+            continue;
+
+        if (slot > this->frames.size())
+            this->frames.resize(slot, nullptr);
+
+        Scope*& frame = this->frames[slot - 1];
+
+        if (frame == nullptr)
+            frame = new Scope("frame");
+
+        frame->function_definitions = snapshot.functions[slot];
+    }
+
+    this->borrowed.insert(snapshot.borrowed.begin(), snapshot.borrowed.end());
+};
+
+/**
+ * The builtins stay defined.
+ */
+void ExecutionContext::clear_scope(Scope* scope) {
+    scope->variables.clear();
+    scope->function_definitions.clear();
+    scope->classes.clear();
+    scope->value = 0;
+};
+
+void ExecutionContext::close_streams() {
+    for (int fd = STDIN_FILENO; fd <= STDERR_FILENO; fd++) {
+        AST_Object_TextStream* stream = this->streams[fd];
+
+        if (stream == nullptr)
+            continue;
+
+        // standard streams do not own their buffers
+        stream->close();
+
+        delete stream->input;
+        delete stream;
+
+        this->streams[fd] = nullptr;
+    }
+};
+
+Scope* ExecutionContext::frame(Scope* declared) {
+    if (declared == nullptr || declared->slot == 0)
+        return this->globals;
+
+    if (declared->slot > this->frames.size())
+        this->frames.resize(declared->slot, nullptr);
+
+    Scope*& frame = this->frames[declared->slot - 1];
+
+    if (frame == nullptr)
+        frame = new Scope(declared->name);
+
+    return frame;
+};
+
+AST_Object_TextStream* ExecutionContext::stream(int fd) {
+    AST_Object_TextStream*& stream = this->streams[fd];
+
+    if (stream != nullptr)
+        return stream;
+
+    if (fd == STDIN_FILENO)
+        stream = new AST_Object_TextStream(new Input(STDIN_FILENO), nullptr);
+    else if (fd == STDOUT_FILENO)
+        stream = new AST_Object_TextStream(nullptr, this->output);
+    else
+        stream = new AST_Object_TextStream(nullptr, this->error_output());
+
+    return stream;
+};
+
+Output* ExecutionContext::error_output() {
+    if (this->error == nullptr) {
+        this->error = new Output(STDERR_FILENO, Output::Line);
+        this->owns_error = true;
+    }
+
+    return this->error;
+};
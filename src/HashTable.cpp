@@ -0,0 +1,314 @@
+#include "includes/HashTable.hpp"
+#include <string.h>
+#include <ctype.h>
+#include <utility>
+
+const int32_t HashTable::EMPTY;
+const int32_t HashTable::DELETED;
+
+HashTable::HashTable() {
+    this->text_compare = false;
+    this->live = 0;
+    this->used_slots = 0;
+    this->modifications = 0;
+    this->next_order = 0;
+};
+
+HashTable::~HashTable() {
+    this->clear();
+};
+
+static const uint64_t ONES = 0x0101010101010101ULL;
+static const uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+static uint64_t mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return h;
+};
+
+/**
+ * Lowercases the ASCII letters of 8 bytes at once.
+ */
+static uint64_t fold_case(uint64_t chunk) {
+    uint64_t heptets = chunk & ~HIGH_BITS;
+    uint64_t above_z = heptets + (0x7F - 'Z') * ONES;
+    uint64_t from_a = heptets + (0x80 - 'A') * ONES;
+    uint64_t is_upper = ~chunk & (from_a ^ above_z) & HIGH_BITS;
+
+    return chunk | (is_upper >> 2);
+};
+
+static uint64_t hash_bytes(const char* data, size_t length, bool text_compare) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ length;
+    uint64_t chunk;
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        memcpy(&chunk, data + i, 8);
+
+        if (text_compare)
+            chunk = fold_case(chunk);
+
+        h = (h ^ mix(chunk)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    if (i < length) {
+        chunk = 0;
+        memcpy(&chunk, data + i, length - i);
+
+        if (text_compare)
+            chunk = fold_case(chunk);
+
+        h = (h ^ mix(chunk)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    return mix(h);
+};
+
+static bool is_number(anything& value) {
+    return value.type() == typeid(int) || value.type() == typeid(float) || value.type() == typeid(bool);
+};
+
+static double to_number(anything& value) {
+    if (value.type() == typeid(int))
+        return boost::get<int>(value);
+    if (value.type() == typeid(float))
+        return boost::get<float>(value);
+
+    return boost::get<bool>(value);
+};
+
+static std::string to_string_key(anything& value) {
+    if (value.type() == typeid(char))
+        return std::string(1, boost::get<char>(value));
+
+    return boost::get<std::string>(value);
+};
+
+static bool is_string(anything& value) {
+    return value.type() == typeid(std::string) || value.type() == typeid(char);
+};
+
+uint64_t HashTable::hash(anything key) {
+    if (key.type() == typeid(std::string)) {
+        const std::string& str = boost::get<std::string>(key);
+        return hash_bytes(str.data(), str.size(), this->text_compare);
+    }
+
+    if (key.type() == typeid(char)) {
+        char c = boost::get<char>(key);
+        return hash_bytes(&c, 1, this->text_compare);
+    }
+
+    if (is_number(key)) {
+        double number = to_number(key) + 0.0; // -0 and 0 are the same key
+        uint64_t bits;
+        memcpy(&bits, &number, sizeof(bits));
+        return mix(bits ^ 0x5bd1e995ULL);
+    }
+
+    return mix((uint64_t)(uintptr_t)boost::get<AST*>(key));
+};
+
+bool HashTable::equals(anything left, anything right) {
+    if (is_string(left) && is_string(right)) {
+        std::string l = to_string_key(left);
+        std::string r = to_string_key(right);
+
+        if (l.size() != r.size())
+            return false;
+
+        if (!this->text_compare)
+            return l == r;
+
+        for (size_t i = 0; i < l.size(); i++)
+            if (tolower((unsigned char)l[i]) != tolower((unsigned char)r[i]))
+                return false;
+
+        return true;
+    }
+
+    if (is_number(left) && is_number(right))
+        return to_number(left) == to_number(right);
+
+    if (left.type() == typeid(AST*) && right.type() == typeid(AST*))
+        return boost::get<AST*>(left) == boost::get<AST*>(right);
+
+    return false;
+};
+
+size_t HashTable::count() {
+    return this->live;
+};
+
+/**
+ * @param anything key
+ * @param uint64_t hash
+ * @param size_t* slot - receives the slot of the key, or the slot where
+ * the key should be inserted.
+ *
+ * @return int32_t - index of the entry, EMPTY if the key does not exist.
+ */
+int32_t HashTable::lookup(anything key, uint64_t hash, size_t* slot) {
+    size_t mask = this->slots.size() - 1;
+    size_t i = hash & mask;
+    size_t first_deleted = (size_t)-1;
+
+    while (true) {
+        int32_t index = this->slots[i];
+
+        if (index == EMPTY) {
+            *slot = first_deleted != (size_t)-1 ? first_deleted : i;
+            return EMPTY;
+        }
+
+        if (index == DELETED) {
+            if (first_deleted == (size_t)-1)
+                first_deleted = i;
+        } else if (this->entries[index].hash == hash && this->equals(this->entries[index].key, key)) {
+            *slot = i;
+            return index;
+        }
+
+        i = (i + 1) & mask;
+    }
+};
+
+/**
+ * Drops removed entries and rebuilds the index with `capacity` slots.
+ */
+void HashTable::rebuild(size_t capacity) {
+    if (this->live != this->entries.size()) {
+        this->modifications++;
+        size_t kept = 0;
+
+        for (size_t i = 0; i < this->entries.size(); i++) {
+            if (this->entries[i].removed)
+                continue;
+
+            if (kept != i)
+                this->entries[kept] = std::move(this->entries[i]);
+
+            kept++;
+        }
+
+        this->entries.resize(kept);
+    }
+
+    this->slots.assign(capacity, EMPTY);
+    this->used_slots = this->entries.size();
+
+    size_t mask = capacity - 1;
+
+    for (size_t index = 0; index < this->entries.size(); index++) {
+        size_t i = this->entries[index].hash & mask;
+
+        while (this->slots[i] != EMPTY)
+            i = (i + 1) & mask;
+
+        this->slots[i] = index;
+    }
+};
+
+/**
+ * @return anything* - the value stored for `key`, nullptr if the key
+ * does not exist. Only valid until the table is modified.
+ */
+anything* HashTable::find(anything key) {
+    if (this->live == 0)
+        return nullptr;
+
+    size_t slot;
+    int32_t index = this->lookup(key, this->hash(key), &slot);
+
+    if (index == EMPTY)
+        return nullptr;
+
+    return &this->entries[index].value;
+};
+
+void HashTable::set(anything key, anything value) {
+    // keep at most half of the slots in use, so probe sequences stay short
+    if ((this->used_slots + 1) * 2 > this->slots.size()) {
+        size_t capacity = 16;
+
+        while (capacity < (this->live + 1) * 4)
+            capacity *= 2;
+
+        this->rebuild(capacity);
+    }
+
+    uint64_t hash = this->hash(key);
+    size_t slot;
+    int32_t index = this->lookup(key, hash, &slot);
+
+    if (index != EMPTY) {
+        this->entries[index].value = value;
+        return;
+    }
+
+    if (this->slots[slot] == EMPTY)
+        this->used_slots++;
+
+    Entry entry;
+    entry.order = this->next_order++;
+    entry.hash = hash;
+    entry.removed = false;
+    entry.key = key;
+    entry.value = value;
+
+    this->slots[slot] = this->entries.size();
+    this->entries.push_back(entry);
+    this->live++;
+};
+
+bool HashTable::remove(anything key) {
+    if (this->live == 0)
+        return false;
+
+    size_t slot;
+    int32_t index = this->lookup(key, this->hash(key), &slot);
+
+    if (index == EMPTY)
+        return false;
+
+    this->slots[slot] = DELETED;
+    this->entries[index].removed = true;
+    this->entries[index].key = 0;
+    this->entries[index].value = 0;
+    this->live--;
+
+    if (this->live == 0)
+        this->clear();
+
+    return true;
+};
+
+size_t HashTable::position(uint64_t order) {
+    size_t low = 0;
+    size_t high = this->entries.size();
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+
+        if (this->entries[middle].order < order)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+};
+
+void HashTable::clear() {
+    this->modifications++;
+    this->entries.clear();
+    this->slots.clear();
+    this->live = 0;
+    this->used_slots = 0;
+};
@@ -0,0 +1,40 @@
+#include "includes/InlineCache.hpp"
+
+
+InlineCache::InlineCache() {
+    for (int i = 0; i < SIZE; i++) {
+        this->classes[i].store(nullptr, std::memory_order_relaxed);
+        this->functions[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    this->used.store(0, std::memory_order_relaxed);
+};
+
+/**
+ * @return AST_BuiltinFunctionDefinition* - nullptr on a cache miss
+ */
+AST_BuiltinFunctionDefinition* InlineCache::find(const void* klass) {
+    int used = this->used.load(std::memory_order_acquire);
+
+    for (int i = 0; i < used; i++)
+        if (this->classes[i].load(std::memory_order_acquire) == klass)
+            return this->functions[i].load(std::memory_order_relaxed);
+
+    return nullptr;
+};
+
+/**
+ * Does nothing once all slots are taken, `used` never grows past `SIZE`.
+ */
+void InlineCache::add(const void* klass, AST_BuiltinFunctionDefinition* function) {
+    int slot = this->used.load(std::memory_order_relaxed);
+
+    do {
+        if (slot >= SIZE)
+            return;
+    } while (!this->used.compare_exchange_weak(slot, slot + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    // publish the function before the class, readers match on the class
+    this->functions[slot].store(function, std::memory_order_relaxed);
+    this->classes[slot].store(klass, std::memory_order_release);
+};
@@ -0,0 +1,112 @@
+#include "includes/Input.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+const size_t Input::BUFFER_SIZE;
+
+
+Input::Input(int fd) {
+    this->fd = fd;
+    this->buffer = new char[BUFFER_SIZE];
+    this->start = 0;
+    this->end = 0;
+    this->eof = false;
+};
+
+Input::~Input() {
+    delete[] this->buffer;
+};
+
+bool Input::fill() {
+    if (this->eof)
+        return false;
+
+    if (this->start > 0) {
+        memmove(this->buffer, this->buffer + this->start, this->end - this->start);
+        this->end -= this->start;
+        this->start = 0;
+    }
+
+    ssize_t n;
+
+    do {
+        n = read(this->fd, this->buffer + this->end, BUFFER_SIZE - this->end);
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0) {
+        this->eof = true;
+        return false;
+    }
+
+    this->end += n;
+
+    return true;
+};
+
+bool Input::at_end() {
+    return this->start == this->end && !this->fill();
+};
+
+bool Input::read_line(std::string& line) {
+    line.clear();
+
+    if (this->at_end())
+        return false;
+
+    while (true) {
+        char* from = this->buffer + this->start;
+        char* newline = (char*)memchr(from, '\n', this->end - this->start);
+
+        if (newline != nullptr) {
+            line.append(from, newline - from);
+            this->start = newline - this->buffer + 1;
+            break;
+        }
+
+        // a line longer than the buffer, or the last line without a newline
+        line.append(from, this->end - this->start);
+        this->start = this->end;
+
+        if (!this->fill())
+            break;
+    }
+
+    if (!line.empty() && line[line.size() - 1] == '\r')
+        line.resize(line.size() - 1);
+
+    return true;
+};
+
+void Input::read_all(std::string& contents) {
+    contents.append(this->buffer + this->start, this->end - this->start);
+    this->start = this->end = 0;
+
+    if (this->eof)
+        return;
+
+    struct stat info;
+    off_t offset = lseek(this->fd, 0, SEEK_CUR);
+
+    if (fstat(this->fd, &info) == 0 && S_ISREG(info.st_mode) && offset >= 0 && info.st_size > offset) {
+        size_t size = info.st_size;
+        void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, this->fd, 0);
+
+        if (map != MAP_FAILED) {
+            madvise(map, size, MADV_SEQUENTIAL);
+            contents.append((const char*)map + offset, size - offset);
+            munmap(map, size);
+            lseek(this->fd, 0, SEEK_END);
+            this->eof = true;
+
+            return;
+        }
+    }
+
+    while (this->fill()) {
+        contents.append(this->buffer, this->end);
+        this->start = this->end = 0;
+    }
+};
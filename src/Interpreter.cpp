@@ -1,14 +1,32 @@
 #include "includes/Interpreter.hpp"
 #include "includes/typedefs.hpp"
+#include "includes/AST/AST_TypedArray.hpp"
+#include "includes/AST/builtin_objects/AST_Object_Dictionary.hpp"
+#include "includes/AST/builtin_objects/AST_Object_Dictionary_View.hpp"
+#include "includes/AST/AST_BuiltinMethodDefinition.hpp"
+#include "includes/AST/AST_ClassInstance.hpp"
+#include "includes/numconv.hpp"
 #include <iostream>
 
 
 Interpreter::Interpreter(Parser* parser) {
     this->parser = parser;
+    this->program = nullptr;
+    this->context = new ExecutionContext(Output::standard());
+};
+
+Interpreter::Interpreter(Program* program, ExecutionContext* context) {
+    this->parser = program->parser;
+    this->program = program;
+    this->context = context;
 };
 
 Interpreter::~Interpreter() {
+    if (this->program != nullptr)
+        return;
+
     delete this->parser;
+    delete this->context;
 };
 
 void Interpreter::error(std::string message) {
@@ -17,7 +35,7 @@ void Interpreter::error(std::string message) {
 
 anything Interpreter::operation(int left, TokenType op, std::string right) {
     if (op == TokenType::Plus)
-        return std::to_string(left) + right;
+        return int_to_string(left) + right;
 
     this->error(op + " is not supported for string and float");
 
@@ -26,7 +44,7 @@ anything Interpreter::operation(int left, TokenType op, std::string right) {
 
 anything Interpreter::operation(std::string left, TokenType op, int right) {
     if (op == TokenType::Plus)
-        return left + std::to_string(right);
+        return left + int_to_string(right);
 
     this->error(op + " is not supported for string and float");
 
@@ -36,7 +54,7 @@ anything Interpreter::operation(std::string left, TokenType op, int right) {
 
 anything Interpreter::operation(float left, TokenType op, std::string right) {
     if (op == TokenType::Plus)
-        return std::to_string(left) + right;
+        return float_to_string(left) + right;
 
     this->error(op + " is not supported for string and float");
 
@@ -45,7 +63,7 @@ anything Interpreter::operation(float left, TokenType op, std::string right) {
 
 anything Interpreter::operation(std::string left, TokenType op, float right) {
     if (op == TokenType::Plus)
-        return left + std::to_string(right);
+        return left + float_to_string(right);
 
     this->error(op + " is not supported for string and float");
 
@@ -118,6 +136,12 @@ anything Interpreter::operation(anything left, TokenType op, anything right) {
     if (left.type() == typeid(float) && right.type() == typeid(float))
         return this->operation(boost::get<float>(left), op, boost::get<float>(right));
 
+    if (left.type() == typeid(int) && right.type() == typeid(float))
+        return this->operation((float)boost::get<int>(left), op, boost::get<float>(right));
+
+    if (left.type() == typeid(float) && right.type() == typeid(int))
+        return this->operation(boost::get<float>(left), op, (float)boost::get<int>(right));
+
     if (left.type() == typeid(bool) && right.type() == typeid(bool))
         return this->operation((int)boost::get<bool>(left), op, (int)boost::get<bool>(right));
 
@@ -236,22 +260,54 @@ int Interpreter::visit_AST_Compound(AST_Compound* node) {
     return 0;
 };
 
+/**
+ * Variables not declared in a function's own scope are looked up in
+ * the script's global scope, like VBScript does.
+ *
+ * @return Scope* - the scope that holds `name`, or `scope` if none does.
+ */
+Scope* Interpreter::variable_scope(Scope* scope, const std::string& name) {
+    Scope* globals = this->context->globals;
+
+    if (scope == globals || scope->has_variable(name) || !globals->has_variable(name))
+        return scope;
+
+    return globals;
+};
+
+/**
+ * Arrays shared with a task (see ExecutionContext::borrowed) are
+ * replaced by a copy in `scope` before they are changed.
+ *
+ * @return AST_Array* - the array to change.
+ */
+AST_Array* Interpreter::writable(Scope* scope, const std::string& name, AST_Array* array) {
+    if (this->context->borrowed.empty() || this->context->borrowed.erase(array) == 0)
+        return array;
+
+    AST_Array* copy = array->copy();
+    scope->set_variable(name, copy);
+
+    return copy;
+};
+
 anything Interpreter::visit_AST_Assign(AST_Assign* node) {
     std::string varname = node->left->value;
+    Scope* scope = this->variable_scope(this->context->frame(node->scope), varname);
 
-    if (!node->get_scope()->has_variable(varname))
+    if (!scope->has_variable(varname))
         this->error("Trying to assign to undeclared variable: `" + varname + "`");
 
-    anything value = this->visit(node->right);
+    anything value = this->stored(this->visit(node->right));
 
-    node->get_scope()->set_variable(varname, value);
+    scope->set_variable(varname, value);
 
     return value;
 };
 
 anything Interpreter::visit_AST_Var(AST_Var* node) {
     std::string varname = node->value;
-    anything value = node->get_scope()->get_variable(varname);
+    anything value = this->variable_scope(this->context->frame(node->scope), varname)->get_variable(varname);
 
     if (value.type() == typeid(AST*))
         value = this->visit(boost::get<AST*>(value));
@@ -260,12 +316,145 @@ anything Interpreter::visit_AST_Var(AST_Var* node) {
 };
 
 int Interpreter::visit_AST_VarDecl(AST_VarDecl* node) {
-    for (std::vector<Token*>::iterator it = node->tokens.begin(); it != node->tokens.end(); ++it)
-        node->get_scope()->set_variable((*it)->value, new AST_Empty(nullptr));
+    Scope* scope = this->context->frame(node->scope);
+
+    for (std::vector<Token*>::iterator it = node->tokens.begin(); it != node->tokens.end(); ++it) {
+        std::map<std::string, std::vector<AST*> >::iterator arr = node->arrays.find((*it)->value);
+
+        if (arr == node->arrays.end()) {
+            scope->set_variable((*it)->value, new AST_Empty(nullptr));
+            continue;
+        }
+
+        AST_Array* array = this->new_array(node->types, (*it)->value);
+
+        if (!arr->second.empty())
+            array->redim(this->array_dimensions(arr->second), false);
+
+        scope->set_variable((*it)->value, array);
+    }
+
+    return 0;
+};
+
+int Interpreter::visit_AST_ReDim(AST_ReDim* node) {
+    for (std::vector<Token*>::iterator it = node->tokens.begin(); it != node->tokens.end(); ++it) {
+        std::string varname = (*it)->value;
+        std::vector<int> dimensions = this->array_dimensions(node->arrays[varname]);
+        AST_Array* array = nullptr;
+        Scope* scope = this->variable_scope(this->context->frame(node->scope), varname);
+
+        if (!scope->has_variable(varname))
+            this->error("Trying to ReDim undeclared variable: `" + varname + "`");
+
+        anything var = scope->get_variable(varname);
+
+        if (var.type() == typeid(AST*) && dynamic_cast<AST_Array*>(boost::get<AST*>(var)))
+            array = this->writable(scope, varname, (AST_Array*)boost::get<AST*>(var));
+
+        if (array == nullptr) {
+            array = this->new_array(node->types, varname);
+            scope->set_variable(varname, array);
+        } else if (node->types.find(varname) != node->types.end()) {
+            if (node->types[varname] != array->get_element_type())
+                this->error("ReDim cannot change the type of: `" + varname + "`");
+        }
+
+        if (node->preserve && array->size() != 0) {
+            if ((int)dimensions.size() != array->get_dimension_count())
+                this->error("ReDim Preserve cannot change the number of dimensions of: `" + varname + "`");
+
+            for (unsigned int i = 0; i + 1 < dimensions.size(); i++)
+                if (dimensions[i] != array->get_length(i))
+                    this->error("ReDim Preserve can only resize the last dimension of: `" + varname + "`");
+        }
+
+        array->redim(dimensions, node->preserve);
+    }
 
     return 0;
 };
 
+/**
+ * Creates the array for a declaration, typed if the declaration
+ * has an `As {type}` for `varname`.
+ *
+ * @param std::map<std::string, TokenType>& types
+ * @param std::string varname
+ *
+ * @return AST_Array*
+ */
+AST_Array* Interpreter::new_array(std::map<std::string, TokenType>& types, std::string varname) {
+    std::map<std::string, TokenType>::iterator type = types.find(varname);
+    AST_Array* array = nullptr;
+
+    if (type != types.end())
+        array = new_typed_array(type->second);
+
+    if (array == nullptr)
+        array = new AST_Array(nullptr);
+
+    return array;
+};
+
+/**
+ * Evaluates the upper bounds of an array declaration into
+ * the number of elements per dimension.
+ *
+ * @param std::vector<AST*> bounds
+ *
+ * @return std::vector<int>
+ */
+std::vector<int> Interpreter::array_dimensions(std::vector<AST*> bounds) {
+    std::vector<int> dimensions;
+
+    for (std::vector<AST*>::iterator it = bounds.begin(); it != bounds.end(); ++it) {
+        anything bound = this->visit((*it));
+
+        if (bound.type() != typeid(int))
+            this->error("Array bounds must be integers");
+
+        if (boost::get<int>(bound) < 0)
+            this->error("Array bounds cannot be negative");
+
+        dimensions.push_back(boost::get<int>(bound) + 1);
+    }
+
+    return dimensions;
+};
+
+/**
+ * Evaluates the indices of an array access into a position in
+ * the items of the array.
+ *
+ * @param AST_Array* array
+ * @param std::vector<AST*> args
+ *
+ * @return int
+ */
+int Interpreter::array_offset(AST_Array* array, std::vector<AST*> args) {
+    std::vector<int> indices;
+
+    if (args.size() == 0)
+        this->error("Accessing array elements requires an argument for index");
+
+    for (std::vector<AST*>::iterator it = args.begin(); it != args.end(); ++it) {
+        anything index = this->visit((*it));
+
+        if (index.type() != typeid(int))
+            this->error("Accessing array elements requires an integer index");
+
+        indices.push_back(boost::get<int>(index));
+    }
+
+    int offset = array->get_offset(indices);
+
+    if (offset < 0)
+        this->error("Array index out of bounds");
+
+    return offset;
+};
+
 int Interpreter::visit_AST_Abstract_Condition(AST_Abstract_Condition* node) {
     std::vector<AST_Abstract_Condition*> conditions;
     conditions.push_back(node);
@@ -333,20 +522,26 @@ int Interpreter::visit_AST_DoWhile(AST_DoWhile* node) {
 };
 
 anything Interpreter::visit_AST_ArrayAccess(AST_ArrayAccess* node) {
-    if (node->args.size() == 0)
-        this->error("Accessing array elements requires an argument for index");
+    return node->array_node->get(this->array_offset(node->array_node, node->args));
+};
 
-    anything index_node = this->visit(node->args[0]);
+anything Interpreter::visit_AST_ArrayAssign(AST_ArrayAssign* node) {
+    Scope* scope = this->variable_scope(this->context->frame(node->scope), node->name);
 
-    if (index_node.type() != typeid(int))
-        this->error("Accessing array elements requires an integer index");
+    if (!scope->has_variable(node->name))
+        this->error("Trying to assign to undeclared variable: `" + node->name + "`");
 
-    int index = boost::get<int>(index_node);
+    anything var = scope->get_variable(node->name);
 
-    if (index > (int)node->array_node->items.size() - 1)
-        this->error("Array index out of bounds");
+    if (var.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(var)))
+        this->error("Trying to assign an element of a non-array: `" + node->name + "`");
+
+    AST_Array* array = this->writable(scope, node->name, (AST_Array*)boost::get<AST*>(var));
+    anything value = this->stored(this->visit(node->right));
+
+    array->set(this->array_offset(array, node->args), value);
 
-    return node->array_node->items[index];
+    return value;
 };
 
 char Interpreter::visit_AST_StringAccess(AST_StringAccess* node) {
@@ -374,9 +569,7 @@ anything Interpreter::visit_AST_functionCall(AST_FunctionCall* node) {
 
         AST_UserDefinedFunctionCall* udfc = (AST_UserDefinedFunctionCall*) node;
         
-        AST_BuiltinFunctionDefinition* bfd = node->get_scope()->get_builtin_function(udfc->name);
-        if (bfd == nullptr)
-            bfd = global_scope->get_builtin_function(udfc->name);
+        AST_BuiltinFunctionDefinition* bfd = this->context->globals->get_builtin_function(udfc->name);
 
         if (bfd != nullptr) {
             if (!bfd->unlimited_args) {
@@ -389,8 +582,10 @@ anything Interpreter::visit_AST_functionCall(AST_FunctionCall* node) {
         }
 
         // be ble to access array and string elements using `(` and `)`
-        if (udfc->get_scope()->has_variable(udfc->name)) {
-            anything var = udfc->get_scope()->get_variable(udfc->name);
+        Scope* scope = this->variable_scope(this->context->frame(udfc->scope), udfc->name);
+
+        if (scope->has_variable(udfc->name)) {
+            anything var = scope->get_variable(udfc->name);
 
             if (var.type() == typeid(AST*)) {
                 AST* ast = boost::get<AST*>(var);
@@ -409,25 +604,26 @@ anything Interpreter::visit_AST_functionCall(AST_FunctionCall* node) {
             }
         }
         
-        udfc->definition = node->get_scope()->get_function_definition(udfc->name);
+        AST_FunctionDefinition* definition = this->context->frame(udfc->scope)->get_function_definition(udfc->name);
 
-        if (udfc->definition == nullptr)
+        if (definition == nullptr)
             this->error("Could not find definition for: " + udfc->name);
 
-        missing_arguments = udfc->definition->args.size() - node->args.size();
+        missing_arguments = definition->args.size() - node->args.size();
 
         if (missing_arguments > 0)
             this->error("Missing " + std::to_string(missing_arguments) + " arguments when calling: " + udfc->name);
 
+        Scope* frame = this->context->frame(definition->scope);
 
         int i = 0;
-        for (std::vector<Token*>::iterator it = udfc->definition->args.begin(); it != udfc->definition->args.end(); ++it) {
-            udfc->definition->get_scope()->set_variable((*it)->value, this->visit(node->args[i]));
+        for (std::vector<Token*>::iterator it = definition->args.begin(); it != definition->args.end(); ++it) {
+            frame->set_variable((*it)->value, this->stored(this->visit(node->args[i])));
             i++;
         }
         
-        ret = this->visit(udfc->call(this));
-        ret = udfc->definition->scope->value;
+        this->visit(definition->body);
+        ret = frame->value;
 
         return ret;
     }
@@ -436,35 +632,358 @@ anything Interpreter::visit_AST_functionCall(AST_FunctionCall* node) {
 };
 
 anything Interpreter::visit_AST_functionDefinition(AST_FunctionDefinition* node) {
-    node->get_parent_scope()->define_function(node);
-    node->get_scope()->define_function(node);
+    this->context->frame(node->parent_scope)->define_function(node);
+    this->context->frame(node->scope)->define_function(node);
     return new AST_NoOp();
 }
 
+/**
+ * Iterates arrays, dictionary views and dictionaries (their keys)
+ * in place through `AST_Array::next`.
+ *
+ * @return int
+ */
+int Interpreter::visit_AST_ForEach(AST_ForEach* node) {
+    std::string varname = node->var->value;
+    Scope* scope = this->variable_scope(this->context->frame(node->scope), varname);
+
+    if (!scope->has_variable(varname))
+        this->error("Trying to assign to undeclared variable: `" + varname + "`");
+
+    anything group = this->visit(node->group);
+
+    if (group.type() != typeid(AST*))
+        this->error("For Each requires an array or a collection");
+
+    AST* ast = boost::get<AST*>(group);
+    AST_Array* array = dynamic_cast<AST_Array*>(ast);
+    AST_Object_Dictionary_View keys(nullptr, false);
+
+    if (AST_Object_Dictionary* dict = dynamic_cast<AST_Object_Dictionary*>(ast)) {
+        keys.table = &dict->table;
+        array = &keys;
+    }
+
+    if (array == nullptr)
+        this->error("For Each requires an array or a collection");
+
+    size_t cursor = 0;
+    anything element;
+
+    while (array->next(cursor, element)) {
+        scope->set_variable(varname, element);
+        this->visit(node->body);
+    }
+
+    return 1;
+};
+
+/**
+ * A function called from inside a With block can run With blocks of
+ * its own at the same depth, so the previous target is restored.
+ *
+ * @return int
+ */
+int Interpreter::visit_AST_With(AST_With* node) {
+    anything target = this->visit(node->target);
+
+    if ((int)this->with_slots.size() <= node->depth)
+        this->with_slots.resize(node->depth + 1);
+
+    anything saved = this->with_slots[node->depth];
+
+    this->with_slots[node->depth] = target;
+    this->visit(node->body);
+    this->with_slots[node->depth] = saved;
+
+    return 1;
+};
+
+anything Interpreter::visit_AST_WithObject(AST_WithObject* node) {
+    return this->with_slots[node->depth];
+};
+
+/**
+ * Values that get stored (assigned, passed as arguments, put into arrays
+ * or dictionaries) must not change behind the script's back, so lazy
+ * dictionary views are copied at this point.
+ *
+ * @return anything
+ */
+anything Interpreter::stored(anything value) {
+    if (value.type() == typeid(AST*))
+        if (AST_Object_Dictionary_View* view = dynamic_cast<AST_Object_Dictionary_View*>(boost::get<AST*>(value)))
+            view->materialize();
+
+    return value;
+};
+
 anything Interpreter::visit_AST_Return(AST_Return* node) {
-    node->scope->value = this->visit(node->value);
-    return node->scope->value;
+    Scope* frame = this->context->frame(node->scope);
+
+    frame->value = this->visit(node->value);
+    return frame->value;
 };
 
-anything Interpreter::visit_AST_AttributeAccess(AST_AttributeAccess* node) {
-    // TODO: visit the left node, fetch that scope and invite the right
-    // node to that scope.
-    //
-    // .. we might have to add `Scope` to all AST:s,
-    // this would mean that all AST:s could have a functions and variables...
-    // (which does make sense)
-    anything left = this->visit(node->left);
+/**
+ * Methods are found through the inline cache of the call site, keyed by
+ * the class of the object: its MethodTable. Objects without one
+ * (extensions) register their methods in their own private scope, so
+ * they are looked up there on every call.
+ */
+anything Interpreter::visit_AST_MemberAccess(AST_MemberAccess* node) {
+    anything left = this->visit(node->object);
 
     if (left.type() != typeid(AST*))
         this->error("Cannot access attributes from this data type");
 
     AST* element = (AST*) boost::get<AST*>( left );
-    node->right->scope = element->private_scope;
-    node->scope = element->private_scope;
+    AST_Object* object = dynamic_cast<AST_Object*>(element);
+    MethodTable* methods = object != nullptr ? object->get_method_table() : nullptr;
+    Scope* scope = methods == nullptr ? element->get_private_scope() : nullptr;
+    AST_BuiltinFunctionDefinition* function;
+
+    if (methods != nullptr) {
+        function = node->cache.find(methods);
+
+        if (function == nullptr) {
+            function = methods->get(node->name);
+
+            if (function != nullptr)
+                node->cache.add(methods, function);
+        }
+    } else {
+        function = scope->get_builtin_function(*node->name);
+    }
+
+    if (function != nullptr) {
+        std::vector<AST*> args = node->call_args();
+
+        if (!function->unlimited_args && function->expected_args.size() > args.size())
+            this->error("Missing " + std::to_string(function->expected_args.size() - args.size()) + " arguments when calling: " + function->name);
+
+        if (methods != nullptr)
+            return this->visit(((AST_BuiltinMethodDefinition*)function)->call_method(element, args, this));
+
+        return this->visit(function->call(args, this));
+    }
+
+    if (AST_ClassInstance* instance = dynamic_cast<AST_ClassInstance*>(element))
+        return this->instance_member(instance, node);
+
+    // `dict.key` and `dict.key(i)` read the entry stored under `key`
+    if (AST_Object_Dictionary* dict = dynamic_cast<AST_Object_Dictionary*>(element))
+        return this->dictionary_member(dict, node);
+
+    if (methods != nullptr)
+        this->error("Object doesn't support this property or method: `" + node->member + "`");
+
+    return this->scope_member(scope, node);
+}
+
+/**
+ * Fields of class instances, private fields are only visible
+ * to the instance's own methods.
+ */
+anything Interpreter::instance_member(AST_ClassInstance* instance, AST_MemberAccess* node) {
+    bool inside = !this->me_stack.empty() && this->me_stack.back() == instance;
+    int slot = instance->definition->get_slot(node->name, inside);
+
+    if (slot < 0)
+        this->error("Object doesn't support this property or method: `" + node->member + "`");
+
+    if (node->kind == AST_MemberAccess::Let) {
+        anything value = this->stored(this->visit(node->value));
+        instance->slots[slot] = value;
 
-    return this->visit(node->right);
+        return value;
+    } else if (node->kind == AST_MemberAccess::CallLet) {
+        anything value = this->stored(this->visit(node->value));
+        this->assign_element(instance->slots[slot], node->args, value, node->member);
+
+        return value;
+    }
+
+    return this->index_value(instance->slots[slot], node->args, node->member);
+}
+
+anything Interpreter::dictionary_member(AST_Object_Dictionary* dict, AST_MemberAccess* node) {
+    if (node->kind == AST_MemberAccess::Let) {
+        anything value = this->stored(this->visit(node->value));
+        dict->table.set(node->member, value);
+
+        return value;
+    } else if (node->kind == AST_MemberAccess::CallLet) {
+        this->error("Cannot assign to an element of dictionary entry: `" + node->member + "`");
+    }
+
+    anything* entry = dict->table.find(node->member);
+
+    if (entry == nullptr)
+        this->error("Key not found in dictionary: `" + node->member + "`");
+
+    return this->index_value(*entry, node->args, node->member);
+}
+
+/**
+ * Attributes of objects that keep their state in their private scope.
+ */
+anything Interpreter::scope_member(Scope* scope, AST_MemberAccess* node) {
+    if (node->kind == AST_MemberAccess::Let) {
+        anything value = this->stored(this->visit(node->value));
+        scope->set_variable(node->member, value);
+
+        return value;
+    }
+
+    if (!scope->has_variable(node->member) || node->kind == AST_MemberAccess::CallLet)
+        this->error("Object doesn't support this property or method: `" + node->member + "`");
+
+    return this->index_value(scope->get_variable(node->member), node->args, node->member);
+}
+
+/**
+ * `value` or `value(args)` for arrays and strings.
+ *
+ * @return anything
+ */
+anything Interpreter::index_value(anything value, std::vector<AST*> args, std::string name) {
+    if (args.empty()) {
+        if (value.type() == typeid(AST*))
+            value = this->visit(boost::get<AST*>(value));
+
+        return value;
+    }
+
+    if (value.type() == typeid(AST*) && dynamic_cast<AST_Array*>(boost::get<AST*>(value)))
+        return this->visit(new AST_ArrayAccess((AST_Array*)boost::get<AST*>(value), args));
+    else if (value.type() == typeid(std::string))
+        return this->visit(new AST_StringAccess(boost::get<std::string>(value), args));
+
+    this->error("Cannot index: `" + name + "`");
+
+    return 0;
 }
 
+/**
+ * `array(args) = value` for arrays that are not stored in a variable.
+ */
+void Interpreter::assign_element(anything target, std::vector<AST*> args, anything value, std::string name) {
+    if (target.type() != typeid(AST*) || !dynamic_cast<AST_Array*>(boost::get<AST*>(target)))
+        this->error("Trying to assign an element of a non-array: `" + name + "`");
+
+    AST_Array* array = (AST_Array*)boost::get<AST*>(target);
+
+    array->set(this->array_offset(array, args), value);
+}
+
+int Interpreter::visit_AST_ClassDefinition(AST_ClassDefinition* node) {
+    Scope* globals = this->context->globals;
+    AST_ClassDefinition* existing = globals->get_class(node->name);
+
+    if (existing == node)
+        return 0;
+
+    if (existing != nullptr)
+        this->error("Name redefined: `" + node->name + "`");
+
+    globals->define_class(node);
+
+    // methods call each other without `Me.`
+    for (std::vector<AST_FunctionDefinition*>::iterator it = node->definitions.begin(); it != node->definitions.end(); ++it)
+        for (std::vector<AST_FunctionDefinition*>::iterator other = node->definitions.begin(); other != node->definitions.end(); ++other)
+            this->context->frame((*it)->scope)->define_function(*other);
+
+    return 0;
+};
+
+anything Interpreter::visit_AST_New(AST_New* node) {
+    AST_ClassDefinition* definition = this->context->globals->get_class(node->name);
+
+    if (definition == nullptr)
+        this->error("Class is not defined: `" + node->name + "`");
+
+    AST_ClassInstance* instance = new AST_ClassInstance(definition);
+
+    for (size_t slot = 0; slot < definition->fields.size(); slot++) {
+        std::string field = definition->fields[slot];
+        std::map<std::string, std::vector<AST*> >::iterator arr = definition->arrays.find(field);
+
+        if (arr == definition->arrays.end())
+            continue;
+
+        AST_Array* array = this->new_array(definition->types, field);
+
+        if (!arr->second.empty())
+            array->redim(this->array_dimensions(arr->second), false);
+
+        instance->slots[slot] = array;
+    }
+
+    if (definition->initialize != nullptr)
+        this->invoke(definition->initialize, instance, std::vector<AST*>());
+
+    return (AST*)instance;
+};
+
+anything Interpreter::visit_AST_Me(AST_Me* node) {
+    return (AST*)this->current_instance();
+};
+
+anything Interpreter::visit_AST_SlotAccess(AST_SlotAccess* node) {
+    AST_ClassInstance* me = this->current_instance();
+
+    return this->index_value(me->slots[node->slot], node->args, node->name);
+};
+
+anything Interpreter::visit_AST_SlotAssign(AST_SlotAssign* node) {
+    AST_ClassInstance* me = this->current_instance();
+    anything value = this->stored(this->visit(node->value));
+
+    if (node->args.empty())
+        me->slots[node->slot] = value;
+    else
+        this->assign_element(me->slots[node->slot], node->args, value, node->name);
+
+    return value;
+};
+
+/**
+ * Runs a method or property of `self`.
+ *
+ * @return anything - the value assigned to the method's name,
+ * Empty if there was none.
+ */
+anything Interpreter::invoke(AST_FunctionDefinition* definition, AST_ClassInstance* self, std::vector<AST*> args) {
+    if (args.size() != definition->args.size())
+        this->error("Wrong number of arguments when calling: " + definition->name);
+
+    std::vector<anything> values;
+
+    for (std::vector<AST*>::iterator it = args.begin(); it != args.end(); ++it)
+        values.push_back(this->stored(this->visit(*it)));
+
+    Scope* scope = this->context->frame(definition->scope);
+
+    for (size_t i = 0; i < values.size(); i++)
+        scope->set_variable(definition->args[i]->value, values[i]);
+
+    scope->value = AST_Array::empty_item();
+
+    this->me_stack.push_back(self);
+    this->visit(definition->body);
+    this->me_stack.pop_back();
+
+    return scope->value;
+};
+
+AST_ClassInstance* Interpreter::current_instance() {
+    if (this->me_stack.empty())
+        this->error("`Me` can only be used inside a class");
+
+    return this->me_stack.back();
+};
+
 AST_Object* Interpreter::visit_AST_Object(AST_Object* node) {
     return node;
 };
@@ -473,6 +992,10 @@ anything Interpreter::visit_AST_Array(AST_Array* node) {
     return node;
 }
 
+anything Interpreter::visit_AST_Value(AST_Value* node) {
+    return node->value;
+};
+
 AST_Empty* Interpreter::visit_AST_Empty(AST_Empty* node) {
     return node;
 };
@@ -480,7 +1003,7 @@ AST_Empty* Interpreter::visit_AST_Empty(AST_Empty* node) {
 int Interpreter::visit_AST_NoOp(AST_NoOp* node) { return 0; };
 
 anything Interpreter::interpret() {
-    AST* tree = this->parser->parse();
+    AST* tree = this->program != nullptr ? this->program->tree : this->parser->parse();
     anything x = this->visit(tree);
     
     return x;
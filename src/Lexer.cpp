@@ -1,12 +1,11 @@
 #include "includes/Lexer.hpp"
+#include "includes/TOKEN_TYPES.hpp"
 #include <sstream>
 #include <iostream>
 #include <map>
 #include <algorithm>
 
 
-extern std::map<std::string, TokenType> RESERVED_KEYWORDS;
-
 Lexer::Lexer(std::string text) {
     this->text = text;
     this->pos = 0;
@@ -329,15 +328,17 @@ Token* Lexer::_id() {
     Token* tok;
     std::string result = "";
 
-    while (this->current_char != '\0' && isalnum(this->current_char)) {
+    while (this->current_char != '\0' && (isalnum(this->current_char) || this->current_char == '_')) {
         result += this->current_char;
         this->advance();
     }
 
     std::transform(result.begin(), result.end(), result.begin(), ::tolower);
     
-    if (RESERVED_KEYWORDS.find(result) != RESERVED_KEYWORDS.end()) {
-        tok = new Token(RESERVED_KEYWORDS[result], result);
+    std::map<std::string, TokenType>::const_iterator keyword = RESERVED_KEYWORDS.find(result);
+
+    if (keyword != RESERVED_KEYWORDS.end()) {
+        tok = new Token(keyword->second, result);
     } else if (this->latest_token->type != TokenType::Function_definition && this->peek_next(this->pos) == '(' && this->peek_next(this->pos) != '=') {
         tok = new Token(TokenType::Function_call, result);
     } else {
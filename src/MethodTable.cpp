@@ -0,0 +1,25 @@
+#include "includes/MethodTable.hpp"
+#include "includes/AST/AST_BuiltinMethodDefinition.hpp"
+
+
+MethodTable::MethodTable(std::string class_name) {
+    this->class_name = class_name;
+};
+
+MethodTable::~MethodTable() {
+    for (std::map<Atom, AST_BuiltinMethodDefinition*>::iterator it = this->methods.begin(); it != this->methods.end(); ++it)
+        delete it->second;
+};
+
+void MethodTable::define(AST_BuiltinMethodDefinition* method) {
+    this->methods[intern(method->name)] = method;
+};
+
+AST_BuiltinMethodDefinition* MethodTable::get(Atom name) {
+    std::map<Atom, AST_BuiltinMethodDefinition*>::iterator it = this->methods.find(name);
+
+    if (it == this->methods.end())
+        return nullptr;
+
+    return it->second;
+};
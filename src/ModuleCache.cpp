@@ -0,0 +1,104 @@
+#include "includes/ModuleCache.hpp"
+#include <thread>
+#include <chrono>
+#include <dlfcn.h>
+
+
+ModuleCache::ModuleCache() {
+    this->stats.loads = 0;
+    this->stats.hits = 0;
+    this->stats.prefetches = 0;
+    this->stats.load_nanoseconds = 0;
+};
+
+/**
+ * The cache is never destroyed, prefetch threads may still be running
+ * when the process exits.
+ */
+ModuleCache* ModuleCache::instance() {
+    static ModuleCache* cache = new ModuleCache();
+
+    return cache;
+};
+
+bool ModuleCache::reserve(std::string path, std::shared_future<Module*>& future, std::promise<Module*>*& promise) {
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    std::map<std::string, std::shared_future<Module*>>::iterator it = this->modules.find(path);
+
+    if (it != this->modules.end()) {
+        future = it->second;
+        return false;
+    }
+
+    promise = new std::promise<Module*>();
+    future = promise->get_future().share();
+    this->modules[path] = future;
+
+    return true;
+};
+
+ModuleCache::Module* ModuleCache::get(std::string path) {
+    std::shared_future<Module*> future;
+    std::promise<Module*>* promise = nullptr;
+
+    if (!this->reserve(path, future, promise)) {
+        this->stats.hits++;
+        return future.get();
+    }
+
+    Module* module = this->load(path);
+    promise->set_value(module);
+    delete promise;
+
+    return module;
+};
+
+void ModuleCache::prefetch(std::string path) {
+    std::shared_future<Module*> future;
+    std::promise<Module*>* promise = nullptr;
+
+    if (!this->reserve(path, future, promise))
+        return;
+
+    this->stats.prefetches++;
+
+    std::thread([this, path, promise]() {
+        promise->set_value(this->load(path));
+        delete promise;
+    }).detach();
+};
+
+/**
+ * Legacy libraries stay open as well, so the dlopen done by DLClass
+ * only has to find the already loaded library.
+ */
+ModuleCache::Module* ModuleCache::load(std::string path) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    Module* module = new Module();
+    module->native = nullptr;
+    module->legacy = nullptr;
+
+    void* handle = dlopen(path.c_str(), RTLD_LAZY);
+
+    if (handle == nullptr) {
+        module->error = std::string("Failed to open library: ") + dlerror();
+    } else {
+        module->native = NativeModule::open(path, handle, module->error);
+
+        if (module->native == nullptr && module->error.empty()) {
+            module->legacy = new DLClass<AST_ObjectCustom>(path);
+
+            if (!module->legacy->open())
+                module->error = "`" + path + "` is not a wscript extension";
+        }
+    }
+
+    this->stats.loads++;
+    this->stats.load_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    return module;
+};
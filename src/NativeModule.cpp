@@ -0,0 +1,76 @@
+#include "includes/NativeModule.hpp"
+#include "includes/AST/AST_NativeMethod.hpp"
+#include <dlfcn.h>
+
+
+NativeModule::NativeModule(std::string path, void* handle, const ws_module* module) {
+    this->path = path;
+    this->handle = handle;
+    this->module = module;
+    this->methods = new MethodTable(module->class_name != nullptr ? module->class_name : path);
+
+    for (size_t i = 0; i < module->method_count; i++)
+        this->methods->define(new AST_NativeMethod(&module->methods[i]));
+};
+
+NativeModule::~NativeModule() {
+    delete this->methods;
+
+    if (this->handle != nullptr)
+        dlclose(this->handle);
+};
+
+/**
+ * @return std::string - empty if the module description can be used.
+ */
+static std::string check_module(const ws_module* module) {
+    if (module == nullptr)
+        return "`" WSCRIPT_MODULE_SYMBOL "` returned no module";
+
+    if (module->abi_version != WSCRIPT_ABI_VERSION)
+        return "built for extension ABI v" + std::to_string(module->abi_version) +
+            ", this interpreter requires v" + std::to_string(WSCRIPT_ABI_VERSION);
+
+    if (module->create == nullptr || module->destroy == nullptr)
+        return "missing create or destroy function";
+
+    if (module->methods == nullptr && module->method_count > 0)
+        return "missing method table";
+
+    for (size_t i = 0; i < module->method_count; i++) {
+        const ws_method* method = &module->methods[i];
+
+        if (method->name == nullptr || method->fn == nullptr || method->arity < 0)
+            return "invalid entry " + std::to_string(i) + " in method table";
+    }
+
+    return "";
+};
+
+NativeModule* NativeModule::open(std::string path, void* handle, std::string& error) {
+    error = "";
+
+    // Reset errors
+    dlerror();
+
+    ws_module_entry_t* entry = (ws_module_entry_t*) dlsym(handle, WSCRIPT_MODULE_SYMBOL);
+
+    if (entry == nullptr)
+        return nullptr;
+
+    return NativeModule::from_entry(path, handle, entry, error);
+};
+
+NativeModule* NativeModule::from_entry(std::string path, void* handle, ws_module_entry_t* entry, std::string& error) {
+    error = "";
+
+    const ws_module* module = entry();
+    std::string problem = check_module(module);
+
+    if (!problem.empty()) {
+        error = "Cannot load extension `" + path + "`: " + problem;
+        return nullptr;
+    }
+
+    return new NativeModule(path, handle, module);
+};
@@ -7,7 +7,9 @@ void NodeVisitor::error(std::string message) {
 };
 
 anything NodeVisitor::visit(AST* node) {
-    if (dynamic_cast<AST_BinOp*>( node ))
+    if (dynamic_cast<AST_Value*>( node ))
+        return this->visit_AST_Value((AST_Value*) node);
+    else if (dynamic_cast<AST_BinOp*>( node ))
         return (anything)this->visit_AST_BinOp((AST_BinOp*) node);
     else if (dynamic_cast<AST_UnaryOp*>( node ))
         return (anything)this->visit_AST_UnaryOp((AST_UnaryOp*) node);
@@ -21,22 +23,42 @@ anything NodeVisitor::visit(AST* node) {
         return (anything)this->visit_AST_Var((AST_Var*) node);
     else if (dynamic_cast<AST_VarDecl*>( node ))
         return (anything)this->visit_AST_VarDecl((AST_VarDecl*) node);
+    else if (dynamic_cast<AST_ReDim*>( node ))
+        return (anything)this->visit_AST_ReDim((AST_ReDim*) node);
     else if (dynamic_cast<AST_Compound*>( node ))
         return (anything)this->visit_AST_Compound((AST_Compound*) node);
     else if (dynamic_cast<AST_Assign*>( node ))
         return (anything)this->visit_AST_Assign((AST_Assign*) node);
+    else if (dynamic_cast<AST_ArrayAssign*>( node ))
+        return (anything)this->visit_AST_ArrayAssign((AST_ArrayAssign*) node);
     else if (dynamic_cast<AST_Abstract_Condition*>( node ))
         return (anything)this->visit_AST_Abstract_Condition((AST_Abstract_Condition*) node);
     else if (dynamic_cast<AST_DoWhile*>( node ))
         return (anything)this->visit_AST_DoWhile((AST_DoWhile*) node);
+    else if (dynamic_cast<AST_ForEach*>( node ))
+        return (anything)this->visit_AST_ForEach((AST_ForEach*) node);
+    else if (dynamic_cast<AST_ClassDefinition*>( node ))
+        return (anything)this->visit_AST_ClassDefinition((AST_ClassDefinition*) node);
+    else if (dynamic_cast<AST_New*>( node ))
+        return this->visit_AST_New((AST_New*) node);
+    else if (dynamic_cast<AST_Me*>( node ))
+        return this->visit_AST_Me((AST_Me*) node);
+    else if (dynamic_cast<AST_SlotAccess*>( node ))
+        return this->visit_AST_SlotAccess((AST_SlotAccess*) node);
+    else if (dynamic_cast<AST_SlotAssign*>( node ))
+        return this->visit_AST_SlotAssign((AST_SlotAssign*) node);
+    else if (dynamic_cast<AST_With*>( node ))
+        return (anything)this->visit_AST_With((AST_With*) node);
+    else if (dynamic_cast<AST_WithObject*>( node ))
+        return this->visit_AST_WithObject((AST_WithObject*) node);
     else if (dynamic_cast<AST_FunctionCall*>( node ))
         return (anything)this->visit_AST_functionCall((AST_FunctionCall*) node);
     else if (dynamic_cast<AST_FunctionDefinition*>( node ))
         return (anything)this->visit_AST_functionDefinition((AST_FunctionDefinition*) node);
     else if (dynamic_cast<AST_Return*>( node ))
         return (anything)this->visit_AST_Return((AST_Return*) node);
-    else if (dynamic_cast<AST_AttributeAccess*>( node ))
-        return (anything)this->visit_AST_AttributeAccess((AST_AttributeAccess*) node);
+    else if (dynamic_cast<AST_MemberAccess*>( node ))
+        return (anything)this->visit_AST_MemberAccess((AST_MemberAccess*) node);
     else if (dynamic_cast<AST_NoOp*>( node ))
         return (anything)this->visit_AST_NoOp((AST_NoOp*) node);
     else if (dynamic_cast<AST_Object*>( node ))
@@ -0,0 +1,69 @@
+#include "includes/Options.hpp"
+#include <stdlib.h>
+
+
+bool parse_options(const std::vector<std::string>& args, Options& options, std::string& error) {
+    options.records = false;
+    options.print = false;
+    options.has_policy = false;
+    options.policy = Output::Full;
+    options.threads = 0;
+    options.processes = 0;
+
+    for (size_t i = 0; i < args.size(); i++) {
+        const std::string& arg = args[i];
+
+        if (arg == "--serve" || arg == "--client") {
+            if (i + 1 >= args.size()) {
+                error = arg + " requires a socket path";
+
+                return false;
+            }
+
+            (arg == "--serve" ? options.serve : options.client) = args[++i];
+            continue;
+        }
+
+        options.forwarded.push_back(arg);
+
+        if (arg == "--batch" || arg == "-j" || arg == "--prefork") {
+            if (i + 1 >= args.size()) {
+                error = arg + (arg == "--batch" ? " requires a jobs file" : " requires a number");
+
+                return false;
+            }
+
+            options.forwarded.push_back(args[++i]);
+
+            if (arg == "--batch") {
+                options.batch = args[i];
+            } else {
+                int& count = arg == "-j" ? options.threads : options.processes;
+                count = atoi(args[i].c_str());
+
+                if (count <= 0) {
+                    error = "invalid number for " + arg + ": " + args[i];
+
+                    return false;
+                }
+            }
+        } else if (arg.compare(0, 8, "--flush=") == 0) {
+            if (!Output::parse_policy(arg.substr(8), options.policy)) {
+                error = "unknown flush policy: " + arg.substr(8) + " (line, full or exit)";
+
+                return false;
+            }
+
+            options.has_policy = true;
+        } else if (arg == "-n" || arg == "-p") {
+            options.records = true;
+            options.print = options.print || arg == "-p";
+        } else if (options.filename.empty()) {
+            options.filename = arg;
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+
+    return true;
+};
@@ -0,0 +1,244 @@
+#include "includes/Output.hpp"
+#include <sys/uio.h>
+#include <unistd.h>
+#include <limits.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <exception>
+#include <mutex>
+#include <set>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+const size_t Output::CHUNK_SIZE;
+const size_t Output::FULL_CHUNKS;
+
+
+/**
+ * Every live Output, so buffered data of streams a script never closed
+ * is still written when the process exits.
+ */
+struct OpenOutputs {
+    std::mutex lock;
+    std::set<Output*> outputs;
+};
+
+static std::terminate_handler previous_terminate = nullptr;
+
+static void flush_open_outputs() {
+    Output::flush_all();
+};
+
+/**
+ * Output written before an uncaught error still has to reach the
+ * terminal before the error message does.
+ */
+static void flush_and_terminate() {
+    flush_open_outputs();
+
+    if (previous_terminate != nullptr)
+        previous_terminate();
+
+    abort();
+};
+
+static OpenOutputs* create_open_outputs() {
+    atexit(flush_open_outputs);
+    previous_terminate = std::set_terminate(flush_and_terminate);
+
+    return new OpenOutputs();
+};
+
+static OpenOutputs* open_outputs() {
+    static OpenOutputs* open = create_open_outputs();
+
+    return open;
+};
+
+Output::Output(int fd, FlushPolicy policy) : Output(nullptr, nullptr, policy) {
+    this->fd = fd;
+};
+
+Output::Output(Sink* sink, void* data, FlushPolicy policy) {
+    this->fd = -1;
+    this->policy = policy;
+    this->sink = sink;
+    this->sink_data = data;
+    this->chunks.push_back(new char[CHUNK_SIZE]);
+    this->lengths.push_back(0);
+    this->current = 0;
+    this->used = 0;
+
+    OpenOutputs* open = open_outputs();
+    std::lock_guard<std::mutex> guard(open->lock);
+    open->outputs.insert(this);
+};
+
+Output::~Output() {
+    this->flush();
+
+    {
+        OpenOutputs* open = open_outputs();
+        std::lock_guard<std::mutex> guard(open->lock);
+        open->outputs.erase(this);
+    }
+
+    for (size_t i = 0; i < this->chunks.size(); i++)
+        delete[] this->chunks[i];
+};
+
+void Output::flush_all() {
+    OpenOutputs* open = open_outputs();
+    std::lock_guard<std::mutex> guard(open->lock);
+
+    for (std::set<Output*>::iterator it = open->outputs.begin(); it != open->outputs.end(); ++it)
+        (*it)->flush();
+};
+
+Output* Output::standard() {
+    static Output* output = new Output(STDOUT_FILENO, Output::default_policy(STDOUT_FILENO));
+
+    return output;
+};
+
+Output::FlushPolicy Output::default_policy(int fd) {
+    return isatty(fd) ? Output::Line : Output::Full;
+};
+
+bool Output::parse_policy(std::string name, FlushPolicy& policy) {
+    if (name == "line")
+        policy = Output::Line;
+    else if (name == "full")
+        policy = Output::Full;
+    else if (name == "exit")
+        policy = Output::Exit;
+    else
+        return false;
+
+    return true;
+};
+
+char* Output::reserve(size_t size) {
+    if (this->used + size > CHUNK_SIZE) {
+        this->lengths[this->current] = this->used;
+        this->current++;
+
+        if (this->policy == Output::Full && this->current == FULL_CHUNKS) {
+            this->current--;
+            this->flush();
+        } else {
+            this->used = 0;
+
+            if (this->current == this->chunks.size()) {
+                this->chunks.push_back(new char[CHUNK_SIZE]);
+                this->lengths.push_back(0);
+            }
+        }
+    }
+
+    return this->chunks[this->current] + this->used;
+};
+
+void Output::commit(size_t size) {
+    this->used += size;
+};
+
+void Output::write(const char* data, size_t size) {
+    while (size > 0) {
+        size_t space = CHUNK_SIZE - this->used;
+
+        if (space == 0) {
+            this->reserve(1);
+            space = CHUNK_SIZE - this->used;
+        }
+
+        size_t n = size < space ? size : space;
+        memcpy(this->chunks[this->current] + this->used, data, n);
+        this->used += n;
+        data += n;
+        size -= n;
+    }
+};
+
+void Output::write(const std::string& value) {
+    this->write(value.data(), value.size());
+};
+
+void Output::put(char c) {
+    *this->reserve(1) = c;
+    this->used++;
+};
+
+void Output::newline() {
+    this->put('\n');
+
+    if (this->policy == Output::Line)
+        this->flush();
+};
+
+size_t Output::pending() {
+    size_t size = this->used;
+
+    for (size_t i = 0; i < this->current; i++)
+        size += this->lengths[i];
+
+    return size;
+};
+
+void Output::flush() {
+    if (this->sink != nullptr) {
+        for (size_t i = 0; i <= this->current; i++) {
+            size_t size = i == this->current ? this->used : this->lengths[i];
+
+            if (size > 0)
+                this->sink(this->sink_data, this->chunks[i], size);
+        }
+
+        this->current = 0;
+        this->used = 0;
+
+        return;
+    }
+
+    if (this->fd < 0)
+        return;
+
+    size_t count = this->current + 1;
+    std::vector<struct iovec> iov(count);
+
+    for (size_t i = 0; i < count; i++) {
+        iov[i].iov_base = this->chunks[i];
+        iov[i].iov_len = i == this->current ? this->used : this->lengths[i];
+    }
+
+    struct iovec* next = iov.data();
+
+    while (count > 0) {
+        ssize_t written = writev(this->fd, next, count < IOV_MAX ? count : IOV_MAX);
+
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        // skip what was written, a partial write ends inside a chunk
+        while (count > 0 && (size_t)written >= next->iov_len) {
+            written -= next->iov_len;
+            next++;
+            count--;
+        }
+
+        if (count > 0) {
+            next->iov_base = (char*)next->iov_base + written;
+            next->iov_len -= written;
+        }
+    }
+
+    this->current = 0;
+    this->used = 0;
+};
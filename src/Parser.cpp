@@ -9,22 +9,35 @@
 #include "includes/AST/AST_Var.hpp"
 #include "includes/AST/AST_Assign.hpp"
 #include "includes/AST/AST_VarDecl.hpp"
+#include "includes/AST/AST_ReDim.hpp"
+#include "includes/AST/AST_ArrayAssign.hpp"
 #include "includes/AST/AST_If.hpp"
 #include "includes/AST/AST_Else.hpp"
 #include "includes/AST/AST_UserDefinedFunctionCall.hpp"
 #include "includes/AST/AST_DoWhile.hpp"
+#include "includes/AST/AST_ForEach.hpp"
+#include "includes/AST/AST_New.hpp"
+#include "includes/AST/AST_Me.hpp"
+#include "includes/AST/AST_Function_CreateObject.hpp"
+#include "includes/ModuleCache.hpp"
+#include "includes/AST/AST_SlotAccess.hpp"
+#include "includes/AST/AST_SlotAssign.hpp"
+#include "includes/AST/AST_With.hpp"
+#include "includes/AST/AST_WithObject.hpp"
 #include "includes/AST/AST_Empty.hpp"
 #include "includes/AST/builtin_objects/AST_WScript.hpp"
 #include <ctype.h>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
 
-extern Scope* global_scope;
-
 Parser::Parser(Lexer* lexer) {
     this->lexer = lexer;
     this->current_token = this->lexer->get_next_token();
+    this->current_class = nullptr;
+    this->with_depth = 0;
+    this->scope = new Scope("global");
 };
 
 Parser::~Parser() {
@@ -109,10 +122,28 @@ AST* Parser::factor(Scope* scope) {
         emp->scope = scope;
         return emp;
 
+    } else if (token->type == TokenType::New) {
+        this->eat(TokenType::New);
+        AST_New* node = new AST_New(this->current_token->value);
+        node->scope = scope;
+        this->eat(TokenType::Id);
+        return node;
+
+    } else if (token->type == TokenType::Dot) {
+        return this->with_member(scope);
+
+    } else if (token->type == TokenType::Me) {
+        this->eat(TokenType::Me);
+        AST_Me* me = new AST_Me();
+        me->scope = scope;
+
+        if (this->current_token->type == TokenType::Dot)
+            return this->attribute_access(me, scope);
+
+        return me;
+
     } else if (token->type == TokenType::Object) {
         this->eat(TokenType::Object);
-        AST_Object* obj;
-
 
         std::transform(
             token->value.begin(),
@@ -122,10 +153,9 @@ AST* Parser::factor(Scope* scope) {
         );
 
         if (token->value == "wscript")
-            obj = new AST_WScript(token);
-        else
-            obj = new AST_Object(token);
+            return AST_WScript::instance();
 
+        AST_Object* obj = new AST_Object(token);
         obj->scope = scope;
         return obj;
     } else if (this->current_token->type == TokenType::Id || this->current_token->type == TokenType::Object || this->current_token->type == TokenType::Dot) {
@@ -139,6 +169,14 @@ AST* Parser::factor(Scope* scope) {
     } else if (token->type == TokenType::Function_call) {
         AST* node = this->function_call(scope);
         node->scope = scope;
+
+        int slot = this->field_slot(((AST_UserDefinedFunctionCall*)node)->name);
+        if (slot >= 0)
+            node = this->field_access(slot, (AST_UserDefinedFunctionCall*)node, scope);
+
+        if (this->current_token->type == TokenType::Dot)
+            return this->attribute_access(node, scope);
+
         return node;
     } else {
         AST* node = this->variable(scope);
@@ -236,7 +274,7 @@ AST* Parser::expr(Scope* scope) {
         if (is_binop) {
             node = new AST_BinOp(node, token, this->term(scope));
         } else {
-            node = new AST_AttributeAccess(node, this->term(scope));
+            node = this->member_access(node, scope);
         }
 
         node->scope = scope;
@@ -296,15 +334,37 @@ std::vector<AST*> Parser::statement_list(Scope* scope) {
 AST* Parser::statement(Scope* scope) {
     if (this->current_token->type == TokenType::Function_definition)
         return this->function_definition(scope);
-    else if (this->current_token->type == TokenType::Function_call)
-        return this->function_call(scope);
-    else if (this->current_token->type == TokenType::Declare)
+    else if (this->current_token->type == TokenType::Function_call) {
+        AST_FunctionCall* call = this->function_call(scope);
+        int slot = this->field_slot(((AST_UserDefinedFunctionCall*)call)->name);
+
+        if (slot >= 0)
+            return this->field_access(slot, (AST_UserDefinedFunctionCall*)call, scope);
+
+        if (this->current_token->type == TokenType::Assign)
+            return this->array_assignment((AST_UserDefinedFunctionCall*)call, scope);
+
+        return call;
+    } else if (this->current_token->type == TokenType::Class)
+        return this->class_definition(scope);
+    else if (this->current_token->type == TokenType::Set) {
+        this->eat(TokenType::Set);
+        return this->statement(scope);
+    } else if (this->current_token->type == TokenType::Declare)
         return this->variable_declaration(scope);
+    else if (this->current_token->type == TokenType::Redim)
+        return this->redim_statement(scope);
     else if (this->current_token->type == TokenType::If)
         return this->if_statement(scope);
     else if (this->current_token->type == TokenType::Do)
         return this->do_while(scope);
-    else if (this->current_token->type == TokenType::Id || this->current_token->type == TokenType::Object)
+    else if (this->current_token->type == TokenType::For)
+        return this->for_each(scope);
+    else if (this->current_token->type == TokenType::With)
+        return this->with_statement(scope);
+    else if (this->current_token->type == TokenType::Dot)
+        return this->with_member(scope);
+    else if (this->current_token->type == TokenType::Id || this->current_token->type == TokenType::Object || this->current_token->type == TokenType::Me)
         return this->expr(scope);
     else
         return this->empty(scope);
@@ -314,6 +374,28 @@ AST* Parser::statement(Scope* scope) {
 
 AST* Parser::id_action(Scope* scope) {
     AST* ast;
+    int slot = current_token->type == TokenType::Id ? this->field_slot(current_token->value) : -1;
+
+    if (slot >= 0) {
+        std::string name = current_token->value;
+        this->eat(TokenType::Id);
+
+        if (current_token->type == TokenType::Assign) {
+            this->eat(TokenType::Assign);
+            AST_SlotAssign* assign = new AST_SlotAssign(slot, name, std::vector<AST*>(), this->expr(scope));
+            assign->scope = scope;
+
+            return assign;
+        }
+
+        ast = new AST_SlotAccess(slot, name, std::vector<AST*>());
+        ast->scope = scope;
+
+        if (current_token->type == TokenType::Dot)
+            return this->attribute_access(ast, scope);
+
+        return ast;
+    }
 
     if (current_token->type == TokenType::Id)
         ast = this->variable(scope);
@@ -337,27 +419,64 @@ AST_Object* Parser::object(Scope* scope) {
     );
 
     if (current_token->value == "wscript") { // TODO: make this more dynamic
-        AST_WScript* obj = new AST_WScript(this->current_token);
-        obj->scope = scope;
-
         this->eat(TokenType::Object);
 
-        return obj;
+        return AST_WScript::instance();
     }
 
     return nullptr;
 }
 
-AST_AttributeAccess* Parser::attribute_access(AST* left, Scope* scope) {
-    this->eat(TokenType::Dot);
+/**
+ * `left.member[.member ...]`
+ *
+ * @return AST*
+ */
+AST* Parser::attribute_access(AST* left, Scope* scope) {
+    AST* node = left;
 
-    AST_AttributeAccess* attr = new AST_AttributeAccess(
-        &*left,
-        this->statement(scope)
-    );
-    attr->scope = scope;
+    while (this->current_token->type == TokenType::Dot) {
+        this->eat(TokenType::Dot);
+        node = this->member_access(node, scope);
+    }
 
-    return attr;
+    return node;
+}
+
+/**
+ * Parses the member after a `.`, see AST_MemberAccess for the forms.
+ *
+ * @return AST_MemberAccess*
+ */
+AST_MemberAccess* Parser::member_access(AST* object, Scope* scope) {
+    std::string member;
+    std::vector<AST*> args;
+    AST* value = nullptr;
+    AST_MemberAccess::Kind kind = AST_MemberAccess::Get;
+
+    if (this->current_token->type == TokenType::Function_call) {
+        AST_UserDefinedFunctionCall* call = (AST_UserDefinedFunctionCall*)this->function_call(scope);
+
+        member = call->name;
+        args = call->args;
+        kind = AST_MemberAccess::Call;
+
+        delete call;
+    } else {
+        member = this->current_token->value;
+        this->eat(TokenType::Id);
+    }
+
+    if (this->current_token->type == TokenType::Assign) {
+        this->eat(TokenType::Assign);
+        value = this->expr(scope);
+        kind = kind == AST_MemberAccess::Call ? AST_MemberAccess::CallLet : AST_MemberAccess::Let;
+    }
+
+    AST_MemberAccess* access = new AST_MemberAccess(object, member, kind, args, value);
+    access->scope = scope;
+
+    return access;
 }
 
 /**
@@ -387,6 +506,14 @@ AST_FunctionCall* Parser::function_call(Scope* scope) {
     
     this->eat(TokenType::Rparen);
 
+    // start loading extensions while the rest of the script is parsed
+    if (function_name == "createobject" && args.size() == 1) {
+        if (AST_Str* str = dynamic_cast<AST_Str*>(args[0])) {
+            if (!AST_Function_CreateObject::is_builtin_class(str->token->value))
+                ModuleCache::instance()->prefetch(str->token->value);
+        }
+    }
+
     AST_UserDefinedFunctionCall* udfc = new AST_UserDefinedFunctionCall(
         args,
         function_name
@@ -403,16 +530,28 @@ AST_FunctionCall* Parser::function_call(Scope* scope) {
  * @return AST_FunctionDefinition*
  */
 AST_FunctionDefinition* Parser::function_definition(Scope* scope) {
-    AST_FunctionDefinition* fd = nullptr;
-    std::vector<Token*> args;
-    AST_Compound* body = new AST_Compound();
-    std::vector<AST*> nodes;
-    std::string function_name;
-
     this->eat(TokenType::Function_definition);
-    function_name = this->current_token->value;
-    Scope* new_scope = new Scope(function_name);
+
+    std::string function_name = this->current_token->value;
     this->eat(TokenType::Id);
+
+    std::vector<Token*> args = this->parameter_list();
+
+    return this->function_body(scope, function_name, args, TokenType::Function_definition);
+};
+
+/**
+ * `(a, b, ...)`, the parentheses are optional when there are no
+ * parameters.
+ *
+ * @return std::vector<Token*>
+ */
+std::vector<Token*> Parser::parameter_list() {
+    std::vector<Token*> args;
+
+    if (this->current_token->type != TokenType::Lparen)
+        return args;
+
     this->eat(TokenType::Lparen);
 
     // if we encounter a RPAREN, we assume no arguments are specified
@@ -428,17 +567,43 @@ AST_FunctionDefinition* Parser::function_definition(Scope* scope) {
             this->eat(TokenType::Id);
         }
     }
-    
+
     this->eat(TokenType::Rparen);
+
+    return args;
+};
+
+/**
+ * Parses the statements of a function, sub or property up to
+ * `End <end>`.
+ *
+ * @return AST_FunctionDefinition*
+ */
+AST_FunctionDefinition* Parser::function_body(Scope* scope, std::string name, std::vector<Token*> args, TokenType end) {
+    AST_FunctionDefinition* fd = nullptr;
+    AST_Compound* body = new AST_Compound();
+    std::vector<AST*> nodes;
+    Scope* new_scope = new Scope(name);
+    this->scopes.push_back(new_scope);
+    new_scope->slot = this->scopes.size();
+
+    // parameters and locals of methods hide fields with the same name
+    if (this->current_class != nullptr) {
+        this->locals.clear();
+
+        for (std::vector<Token*>::iterator it = args.begin(); it != args.end(); ++it)
+            this->locals.push_back((*it)->value);
+    }
+
     nodes = this->statement_list(new_scope);
     this->eat(TokenType::End);
-    this->eat(TokenType::Function_definition);
+    this->eat(end);
 
     for (std::vector<AST*>::iterator it = nodes.begin(); it != nodes.end(); ++it)
         body->children.push_back((*it));
 
     fd = new AST_FunctionDefinition(
-        function_name,
+        name,
         args,
         body
     );
@@ -449,6 +614,186 @@ AST_FunctionDefinition* Parser::function_definition(Scope* scope) {
     return fd;
 };
 
+/**
+ * `Property Get|Let|Set name[(args)] ... End Property`
+ *
+ * @param bool& setter - set to false for Get, true for Let and Set
+ *
+ * @return AST_FunctionDefinition*
+ */
+AST_FunctionDefinition* Parser::property_definition(Scope* scope, bool& setter) {
+    this->eat(TokenType::Property);
+
+    if (this->current_token->type == TokenType::Set) {
+        this->eat(TokenType::Set);
+        setter = true;
+    } else {
+        std::string accessor = this->current_token->value;
+        this->eat(TokenType::Id);
+
+        if (accessor != "get" && accessor != "let")
+            this->error("Expected Get, Let or Set after Property");
+
+        setter = accessor == "let";
+    }
+
+    std::string property_name = this->current_token->value;
+
+    if (this->current_token->type == TokenType::Function_call)
+        this->eat(TokenType::Function_call);
+    else
+        this->eat(TokenType::Id);
+
+    std::vector<Token*> args = this->parameter_list();
+
+    return this->function_body(scope, property_name, args, TokenType::Property);
+};
+
+/**
+ * `Class name ... End Class`
+ *
+ * @return AST_ClassDefinition*
+ */
+AST_ClassDefinition* Parser::class_definition(Scope* scope) {
+    this->eat(TokenType::Class);
+
+    AST_ClassDefinition* definition = new AST_ClassDefinition(this->current_token->value);
+    definition->scope = scope;
+    this->eat(TokenType::Id);
+
+    this->class_fields(definition);
+    this->current_class = definition;
+
+    while (true) {
+        while (this->current_token->type == TokenType::Newline || this->current_token->type == TokenType::Colon)
+            this->eat(this->current_token->type);
+
+        if (this->current_token->type == TokenType::End) {
+            this->eat(TokenType::End);
+            this->eat(TokenType::Class);
+            break;
+        }
+
+        bool is_public = true;
+
+        if (this->current_token->type == TokenType::Public) {
+            this->eat(TokenType::Public);
+        } else if (this->current_token->type == TokenType::Private) {
+            this->eat(TokenType::Private);
+            is_public = false;
+        }
+
+        if (this->current_token->type == TokenType::Function_definition) {
+            definition->add_method(this->function_definition(scope), is_public);
+        } else if (this->current_token->type == TokenType::Property) {
+            bool setter = false;
+            AST_FunctionDefinition* property = this->property_definition(scope, setter);
+
+            definition->add_property(property, setter, is_public);
+        } else {
+            std::vector<Token*> tokens;
+
+            if (this->current_token->type == TokenType::Declare)
+                this->eat(TokenType::Declare);
+
+            this->declaration_list(scope, tokens, definition->arrays, definition->types);
+
+            for (std::vector<Token*>::iterator it = tokens.begin(); it != tokens.end(); ++it)
+                definition->add_field((*it)->value, is_public);
+        }
+    }
+
+    this->current_class = nullptr;
+    this->locals.clear();
+
+    return definition;
+};
+
+/**
+ * Reads ahead to `End Class` and gives every field a slot, so that
+ * methods can use fields that are declared after them.
+ */
+void Parser::class_fields(AST_ClassDefinition* definition) {
+    Lexer scan = *this->lexer;
+    Token* token = scan.get_next_token();
+    int depth = 0;
+
+    while (token->type != TokenType::Eof) {
+        TokenType type = token->type;
+        token = scan.get_next_token();
+
+        if (type == TokenType::End) {
+            if (token->type == TokenType::Class)
+                return;
+
+            if (token->type == TokenType::Function_definition || token->type == TokenType::Property)
+                depth--;
+
+            token = scan.get_next_token();
+        } else if (type == TokenType::Function_definition || type == TokenType::Property) {
+            depth++;
+        } else if (depth == 0 && (type == TokenType::Public || type == TokenType::Private || type == TokenType::Declare)) {
+            if (token->type == TokenType::Function_definition || token->type == TokenType::Property)
+                continue;
+
+            // every name at the start of the list or after a comma,
+            // commas inside array dimensions do not count.
+            bool expect_name = true;
+            int parens = 0;
+
+            while (token->type != TokenType::Newline && token->type != TokenType::Colon && token->type != TokenType::Eof) {
+                if (expect_name && (token->type == TokenType::Id || token->type == TokenType::Function_call)) {
+                    definition->add_field(token->value, type != TokenType::Private);
+                    expect_name = false;
+                } else if (token->type == TokenType::Lparen) {
+                    parens++;
+                } else if (token->type == TokenType::Rparen) {
+                    parens--;
+                } else if (token->type == TokenType::Comma && parens == 0) {
+                    expect_name = true;
+                }
+
+                token = scan.get_next_token();
+            }
+        }
+    }
+};
+
+/**
+ * @return int - the slot of `name` if it refers to a field of the class
+ * being parsed, -1 otherwise.
+ */
+int Parser::field_slot(std::string name) {
+    if (this->current_class == nullptr)
+        return -1;
+
+    if (std::find(this->locals.begin(), this->locals.end(), name) != this->locals.end())
+        return -1;
+
+    return this->current_class->get_slot(intern(name), true);
+};
+
+/**
+ * `field(args)` or `field(args) = value` inside a class.
+ *
+ * @return AST*
+ */
+AST* Parser::field_access(int slot, AST_UserDefinedFunctionCall* call, Scope* scope) {
+    AST* node;
+
+    if (this->current_token->type == TokenType::Assign) {
+        this->eat(TokenType::Assign);
+        node = new AST_SlotAssign(slot, call->name, call->args, this->expr(scope));
+    } else {
+        node = new AST_SlotAccess(slot, call->name, call->args);
+    }
+
+    node->scope = scope;
+    delete call;
+
+    return node;
+};
+
 /**
  * Parses an assign statement
  *
@@ -561,30 +906,238 @@ AST_DoWhile* Parser::do_while(Scope* scope) {
 };
 
 /**
- * Parses the declaration of a variable
+ * `With target` ... `End With`
+ *
+ * @return AST_With*
+ */
+AST_With* Parser::with_statement(Scope* scope) {
+    AST_Compound* body = new AST_Compound();
+    body->scope = scope;
+    std::vector<AST*> nodes;
+
+    this->eat(TokenType::With);
+
+    AST* target = this->expr(scope);
+    int depth = this->with_depth++;
+
+    nodes = this->statement_list(scope);
+    this->eat(TokenType::End);
+    this->eat(TokenType::With);
+
+    this->with_depth--;
+
+    for(std::vector<AST*>::iterator it = nodes.begin(); it != nodes.end(); ++it)
+        body->children.push_back((*it));
+
+    AST_With* with = new AST_With(target, body, depth);
+    with->scope = scope;
+
+    return with;
+};
+
+/**
+ * `.member` inside a With block.
  *
- * TODO: implement "Dim As {type}"
+ * @return AST*
+ */
+AST* Parser::with_member(Scope* scope) {
+    if (this->with_depth == 0)
+        this->error("Invalid or unqualified reference");
+
+    AST_WithObject* object = new AST_WithObject(this->with_depth - 1);
+    object->scope = scope;
+
+    return this->attribute_access(object, scope);
+};
+
+/**
+ * `For Each element In group` ... `Next`
+ *
+ * @return AST_ForEach*
+ */
+AST_ForEach* Parser::for_each(Scope* scope) {
+    AST_Compound* body = new AST_Compound();
+    body->scope = scope;
+    std::vector<AST*> nodes;
+
+    this->eat(TokenType::For);
+    this->eat(TokenType::Each);
+
+    Token* var = this->current_token;
+    this->eat(TokenType::Id);
+    this->eat(TokenType::In);
+
+    AST* group = this->expr(scope);
+
+    nodes = this->statement_list(scope);
+    this->eat(TokenType::Next);
+
+    for(std::vector<AST*>::iterator it = nodes.begin(); it != nodes.end(); ++it)
+        body->children.push_back((*it));
+
+    AST_ForEach* fe = new AST_ForEach(var, group, body);
+    fe->scope = scope;
+
+    return fe;
+};
+
+/**
+ * Parses the declaration of a variable
  *
  * @return AST*
  */
 AST* Parser::variable_declaration(Scope* scope) {
     std::vector<Token*> tokens;
+    std::map<std::string, std::vector<AST*> > arrays;
+    std::map<std::string, TokenType> types;
     
     this->eat(TokenType::Declare);
+    this->declaration_list(scope, tokens, arrays, types);
 
-    tokens.push_back(this->current_token);
-    this->eat(TokenType::Id);
+    if (this->current_class != nullptr)
+        for (std::vector<Token*>::iterator it = tokens.begin(); it != tokens.end(); ++it)
+            this->locals.push_back((*it)->value);
+
+    AST_VarDecl* vd = new AST_VarDecl(tokens, arrays, types);
+    vd->scope = scope;
+
+    return vd;
+};
+
+/**
+ * Parses a resize of one or more arrays,
+ * `ReDim [Preserve] a(n[, m])`
+ *
+ * @return AST*
+ */
+AST* Parser::redim_statement(Scope* scope) {
+    std::vector<Token*> tokens;
+    std::map<std::string, std::vector<AST*> > arrays;
+    std::map<std::string, TokenType> types;
+    bool preserve = false;
+
+    this->eat(TokenType::Redim);
+
+    if (this->current_token->type == TokenType::Preserve) {
+        this->eat(TokenType::Preserve);
+        preserve = true;
+    }
+
+    this->declaration_list(scope, tokens, arrays, types);
+
+    for (std::vector<Token*>::iterator it = tokens.begin(); it != tokens.end(); ++it)
+        if (arrays.find((*it)->value) == arrays.end())
+            this->error("ReDim requires dimensions for: `" + (*it)->value + "`");
+
+    AST_ReDim* rd = new AST_ReDim(tokens, arrays, types, preserve);
+    rd->scope = scope;
+
+    return rd;
+};
+
+/**
+ * Parses a comma separated list of names, where every name can be followed
+ * by a list of array bounds and a type: `x, a(10), b(2, 3) As Double`.
+ *
+ * Types are only used by arrays, their elements are stored unboxed.
+ * Plain variables are always variants.
+ *
+ * @param Scope* scope
+ * @param std::vector<Token*>& tokens - receives the names
+ * @param std::map<std::string, std::vector<AST*> >& arrays - receives the
+ * bounds of the names that were declared as arrays
+ * @param std::map<std::string, TokenType>& types - receives the types of
+ * the names that were declared with `As {type}`
+ */
+void Parser::declaration_list(Scope* scope, std::vector<Token*>& tokens, std::map<std::string, std::vector<AST*> >& arrays, std::map<std::string, TokenType>& types) {
+    while (true) {
+        Token* token = this->current_token;
+        tokens.push_back(token);
+
+        if (token->type == TokenType::Function_call) {
+            this->eat(TokenType::Function_call);
+            arrays[token->value] = this->array_dimensions(scope);
+        } else {
+            this->eat(TokenType::Id);
+        }
+
+        if (this->current_token->type == TokenType::As) {
+            this->eat(TokenType::As);
+            types[token->value] = this->type_name();
+        }
+
+        if (this->current_token->type != TokenType::Comma)
+            break;
 
-    while (this->current_token->type == TokenType::Comma) {
         this->eat(TokenType::Comma);
-        tokens.push_back(this->current_token);
-        this->eat(TokenType::Id);
     }
+};
 
-    AST_VarDecl* vd = new AST_VarDecl(tokens);
-    vd->scope = scope;
+/**
+ * Parses the type in `As {type}`
+ *
+ * @return TokenType - TokenType::Anything for Variant
+ */
+TokenType Parser::type_name() {
+    static const std::map<std::string, TokenType> TYPE_NAMES = {
+        {"double", TokenType::Double},
+        {"single", TokenType::Single},
+        {"long", TokenType::Long},
+        {"integer", TokenType::Integer},
+        {"byte", TokenType::Byte},
+        {"boolean", TokenType::Boolean},
+        {"string", TokenType::String},
+        {"variant", TokenType::Anything}
+    };
 
-    return vd;
+    std::map<std::string, TokenType>::const_iterator type = TYPE_NAMES.find(this->current_token->value);
+
+    if (type == TYPE_NAMES.end())
+        this->error("Unknown type: `" + this->current_token->value + "`");
+
+    this->eat(TokenType::Id);
+
+    return type->second;
+};
+
+/**
+ * Parses the bounds of an array declaration, `(n[, m])`
+ *
+ * @return std::vector<AST*>
+ */
+std::vector<AST*> Parser::array_dimensions(Scope* scope) {
+    std::vector<AST*> dimensions;
+
+    this->eat(TokenType::Lparen);
+
+    if (this->current_token->type != TokenType::Rparen) {
+        dimensions.push_back(this->expr(scope));
+
+        while (this->current_token->type == TokenType::Comma) {
+            this->eat(TokenType::Comma);
+            dimensions.push_back(this->expr(scope));
+        }
+    }
+
+    this->eat(TokenType::Rparen);
+
+    return dimensions;
+};
+
+/**
+ * Parses an assignment to an array element, `a(i, j) = expr`
+ *
+ * @return AST*
+ */
+AST* Parser::array_assignment(AST_UserDefinedFunctionCall* left, Scope* scope) {
+    Token* token = this->current_token;
+    this->eat(TokenType::Assign);
+    AST* right = this->expr(scope);
+
+    AST_ArrayAssign* node = new AST_ArrayAssign(left->name, left->args, token, right);
+    node->scope = scope;
+
+    return node;
 };
 
 /**
@@ -618,5 +1171,5 @@ AST* Parser::empty(Scope* scope) {
  * @return AST*
  */
 AST* Parser::parse() {
-    return this->any_statement(global_scope);
+    return this->any_statement(this->scope);
 };
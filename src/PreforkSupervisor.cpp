@@ -0,0 +1,398 @@
+#include "includes/PreforkSupervisor.hpp"
+#include "includes/BatchRunner.hpp"
+#include "includes/Interpreter.hpp"
+#include "includes/ExecutionContext.hpp"
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <string.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <chrono>
+#include <iostream>
+#include <new>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+const int PreforkSupervisor::MAX_PROCESSES;
+const uint32_t PreforkSupervisor::MAX_PENDING;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "the job queue needs lock free atomics");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futexes are 32 bit words");
+
+
+/**
+ * Sleeps until `word` no longer holds `seen`, or for a while where
+ * there are no futexes.
+ */
+static void wait_for_change(std::atomic<uint32_t>* word, uint32_t seen) {
+#ifdef __linux__
+    syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT, seen, nullptr, nullptr, 0);
+#else
+    if (word->load() == seen)
+        usleep(1000);
+#endif
+};
+
+static void wake_all(std::atomic<uint32_t>* word) {
+#ifdef __linux__
+    syscall(SYS_futex, (uint32_t*)word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+};
+
+static bool write_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        data += written;
+        size -= written;
+    }
+
+    return true;
+};
+
+PreforkSupervisor::PreforkSupervisor(std::string path, int processes) {
+    this->path = path;
+    this->processes = processes < MAX_PROCESSES ? processes : MAX_PROCESSES;
+    this->queue = nullptr;
+};
+
+/**
+ * Programs are kept, freeing an AST is not supported.
+ */
+PreforkSupervisor::~PreforkSupervisor() {
+    if (this->queue != nullptr)
+        munmap(this->queue, sizeof(SharedQueue));
+};
+
+int PreforkSupervisor::run() {
+    std::string error;
+
+    if (!BatchRunner::read_jobs(this->path, this->jobs, error)) {
+        std::cerr << error << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < this->jobs.size(); i++) {
+        const std::string& job = this->jobs[i];
+
+        if (this->programs.count(job) || this->errors.count(job))
+            continue;
+
+        try {
+            Program* program = BatchRunner::parse_file(job);
+            this->programs[job] = program;
+        } catch (std::exception& e) {
+            this->errors[job] = e.what();
+        }
+    }
+
+    void* memory = mmap(nullptr, sizeof(SharedQueue), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (memory == MAP_FAILED) {
+        std::cerr << "cannot map the job queue: " << strerror(errno) << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    this->queue = new (memory) SharedQueue();
+    this->queue->count = this->jobs.size();
+    this->queue->next.store(0);
+    this->queue->emitted.store(0);
+
+    for (int i = 0; i < MAX_PROCESSES; i++)
+        this->queue->running[i].store(-1);
+
+    this->results.resize(this->jobs.size());
+
+    for (size_t i = 0; i < this->results.size(); i++) {
+        this->results[i].done = false;
+        this->results[i].failed = false;
+        this->results[i].nanoseconds = 0;
+    }
+
+    // a worker that dies must not take the supervisor with it
+    signal(SIGPIPE, SIG_IGN);
+
+    this->workers.resize(this->processes);
+
+    for (int i = 0; i < this->processes; i++) {
+        this->workers[i].fd = -1;
+
+        if (!this->spawn(i))
+            return EXIT_FAILURE;
+    }
+
+    int status = EXIT_SUCCESS;
+    uint32_t emitted = 0;
+
+    while (true) {
+        while (emitted < this->results.size() && this->results[emitted].done) {
+            Result& result = this->results[emitted];
+
+            write_all(STDOUT_FILENO, result.output.data(), result.output.size());
+            write_all(STDERR_FILENO, result.error.data(), result.error.size());
+
+            if (result.failed)
+                status = EXIT_FAILURE;
+
+            std::string().swap(result.output);
+            std::string().swap(result.error);
+
+            this->queue->emitted.store(++emitted);
+            wake_all(&this->queue->emitted);
+        }
+
+        std::vector<struct pollfd> fds;
+        std::vector<int> slots;
+
+        for (int i = 0; i < this->processes; i++) {
+            if (this->workers[i].fd < 0)
+                continue;
+
+            struct pollfd fd;
+            fd.fd = this->workers[i].fd;
+            fd.events = POLLIN;
+            fd.revents = 0;
+
+            fds.push_back(fd);
+            slots.push_back(i);
+        }
+
+        if (fds.empty()) {
+            if (emitted == this->results.size())
+                break;
+
+            // claimed by workers that died before saying which
+            for (size_t i = emitted; i < this->results.size(); i++) {
+                if (this->results[i].done)
+                    continue;
+
+                this->results[i].done = true;
+                this->results[i].failed = true;
+                this->results[i].error = this->jobs[i] + ": not run\n";
+            }
+
+            continue;
+        }
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+
+            std::cerr << "poll failed: " << strerror(errno) << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        for (size_t i = 0; i < fds.size(); i++)
+            if (fds[i].revents != 0 && !this->receive(this->workers[slots[i]]))
+                this->reap(slots[i]);
+    }
+
+    std::vector<long> latencies;
+    size_t failed = 0;
+
+    for (size_t i = 0; i < this->results.size(); i++) {
+        latencies.push_back(this->results[i].nanoseconds);
+
+        if (this->results[i].failed)
+            failed++;
+    }
+
+    BatchRunner::report(latencies, failed, std::to_string(this->processes) + " processes", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    return status;
+};
+
+bool PreforkSupervisor::spawn(int slot) {
+    int pipe_fds[2];
+
+    if (pipe2(pipe_fds, O_CLOEXEC) != 0) {
+        std::cerr << "cannot create a pipe: " << strerror(errno) << std::endl;
+
+        return false;
+    }
+
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        std::cerr << "cannot fork a worker: " << strerror(errno) << std::endl;
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+
+        return false;
+    }
+
+    if (pid == 0) {
+        close(pipe_fds[0]);
+
+        for (size_t i = 0; i < this->workers.size(); i++)
+            if (this->workers[i].fd >= 0)
+                close(this->workers[i].fd);
+
+        this->work(slot, pipe_fds[1]);
+    }
+
+    close(pipe_fds[1]);
+
+    this->workers[slot].pid = pid;
+    this->workers[slot].fd = pipe_fds[0];
+    this->workers[slot].received.clear();
+
+    return true;
+};
+
+void PreforkSupervisor::work(int slot, int fd) {
+    SharedQueue* queue = this->queue;
+
+    while (true) {
+        uint32_t job = queue->next.fetch_add(1);
+
+        if (job >= queue->count)
+            break;
+
+        queue->running[slot].store(job);
+
+        uint32_t emitted = queue->emitted.load();
+
+        // job `emitted` is never the one waiting, so this always ends
+        while (job >= emitted + MAX_PENDING) {
+            wait_for_change(&queue->emitted, emitted);
+            emitted = queue->emitted.load();
+        }
+
+        this->run_job(job, fd);
+        queue->running[slot].store(-1);
+    }
+
+    _exit(EXIT_SUCCESS);
+};
+
+void PreforkSupervisor::run_job(uint32_t job, int fd) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const std::string& path = this->jobs[job];
+    Output output(-1, Output::Exit);
+    Output error(-1, Output::Exit);
+    bool failed = false;
+
+    try {
+        std::map<std::string, Program*>::iterator it = this->programs.find(path);
+
+        if (it == this->programs.end())
+            throw std::runtime_error(this->errors[path]);
+
+        ExecutionContext context(&output, &error);
+        Interpreter interpreter(it->second, &context);
+
+        interpreter.interpret();
+    } catch (std::exception& e) {
+        error.write(path + ": " + e.what());
+        error.newline();
+        failed = true;
+    }
+
+    Frame frame;
+    frame.job = job;
+    frame.failed = failed;
+    frame.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    frame.output = output.pending();
+    frame.error = error.pending();
+
+    if (!write_all(fd, (const char*)&frame, sizeof(frame)))
+        _exit(EXIT_FAILURE);
+
+    output.fd = fd;
+    output.flush();
+    output.fd = -1;
+
+    error.fd = fd;
+    error.flush();
+    error.fd = -1;
+};
+
+bool PreforkSupervisor::receive(Worker& worker) {
+    char buffer[64 * 1024];
+    ssize_t size = read(worker.fd, buffer, sizeof(buffer));
+
+    if (size < 0)
+        return errno == EINTR || errno == EAGAIN;
+
+    if (size == 0)
+        return false;
+
+    worker.received.append(buffer, size);
+
+    while (worker.received.size() >= sizeof(Frame)) {
+        Frame frame;
+        memcpy(&frame, worker.received.data(), sizeof(frame));
+
+        size_t end = sizeof(frame) + frame.output + frame.error;
+
+        if (worker.received.size() < end)
+            break;
+
+        if (frame.job < this->results.size()) {
+            Result& result = this->results[frame.job];
+            result.done = true;
+            result.failed = frame.failed != 0;
+            result.nanoseconds = frame.nanoseconds;
+            result.output.assign(worker.received, sizeof(frame), frame.output);
+            result.error.assign(worker.received, sizeof(frame) + frame.output, frame.error);
+        }
+
+        worker.received.erase(0, end);
+    }
+
+    return true;
+};
+
+/**
+ * Collects a worker whose pipe was closed and replaces it while there
+ * are jobs left.
+ */
+void PreforkSupervisor::reap(int slot) {
+    Worker& worker = this->workers[slot];
+    int status = 0;
+
+    close(worker.fd);
+    worker.fd = -1;
+
+    while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR)
+        continue;
+
+    int64_t job = this->queue->running[slot].load();
+
+    if (job >= 0 && !this->results[job].done) {
+        Result& result = this->results[job];
+        std::string reason = WIFSIGNALED(status)
+            ? std::string("killed by signal ") + strsignal(WTERMSIG(status))
+            : "exited with status " + std::to_string(WEXITSTATUS(status));
+
+        result.done = true;
+        result.failed = true;
+        result.error = this->jobs[job] + ": worker " + reason + "\n";
+    }
+
+    this->queue->running[slot].store(-1);
+
+    if (this->queue->next.load() < this->queue->count)
+        this->spawn(slot);
+};
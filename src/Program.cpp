@@ -0,0 +1,14 @@
+#include "includes/Program.hpp"
+
+
+Program::Program(std::string source) {
+    this->parser = new Parser(new Lexer(source));
+    this->tree = this->parser->parse();
+};
+
+/**
+ * Keeps the tree, freeing an AST is not supported.
+ */
+Program::~Program() {
+    delete this->parser;
+};
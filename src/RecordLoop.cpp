@@ -0,0 +1,96 @@
+#include "includes/RecordLoop.hpp"
+#include "includes/AST/AST_VarDecl.hpp"
+#include "includes/AST/AST_FunctionDefinition.hpp"
+#include "includes/AST/AST_ClassDefinition.hpp"
+#include "includes/AST/AST_TypedArray.hpp"
+#include "includes/AST/builtin_objects/AST_Object_TextStream.hpp"
+#include "includes/Output.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+
+RecordLoop::RecordLoop(Interpreter* interpreter, bool print) {
+    this->interpreter = interpreter;
+    this->print = print;
+    this->body = new AST_Compound();
+    this->line_number = 0;
+};
+
+RecordLoop::~RecordLoop() {
+    this->body->children.clear();
+    delete this->body;
+};
+
+void RecordLoop::call_hook(std::string name) {
+    AST_FunctionDefinition* definition = this->interpreter->context->globals->get_function_definition(name);
+
+    if (definition != nullptr)
+        this->interpreter->invoke(definition, nullptr, std::vector<AST*>());
+};
+
+void RecordLoop::run(AST* tree, std::vector<std::string> inputs) {
+    AST_Compound* root = (AST_Compound*)tree;
+    AST_Compound setup;
+
+    setup.scope = root->scope;
+    this->body->scope = root->scope;
+
+    for (std::vector<AST*>::iterator it = root->children.begin(); it != root->children.end(); ++it) {
+        if (dynamic_cast<AST_VarDecl*>(*it) || dynamic_cast<AST_FunctionDefinition*>(*it) || dynamic_cast<AST_ClassDefinition*>(*it))
+            setup.children.push_back(*it);
+        else
+            this->body->children.push_back(*it);
+    }
+
+    Scope* globals = this->interpreter->context->globals;
+
+    globals->set_variable("line", std::string());
+    globals->set_variable("linenumber", 0);
+
+    this->interpreter->visit(&setup);
+    setup.children.clear();
+
+    this->call_hook("onbegin");
+
+    if (inputs.empty())
+        inputs.push_back("-");
+
+    for (std::vector<std::string>::iterator it = inputs.begin(); it != inputs.end(); ++it) {
+        // shares its buffer with WScript.StdIn
+        if (*it == "-") {
+            this->read(this->interpreter->context->stream(STDIN_FILENO)->reader());
+            continue;
+        }
+
+        int fd = open(it->c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+            this->interpreter->error("Cannot open input file: " + *it + ": " + strerror(errno));
+
+        Input input(fd);
+        this->read(&input);
+        close(fd);
+    }
+
+    this->call_hook("onend");
+};
+
+void RecordLoop::read(Input* input) {
+    std::string line;
+    Scope* globals = this->interpreter->context->globals;
+    Output* output = this->interpreter->context->output;
+
+    while (input != nullptr && input->read_line(line)) {
+        globals->set_variable("line", line);
+        globals->set_variable("linenumber", ++this->line_number);
+
+        this->interpreter->visit(this->body);
+
+        if (this->print) {
+            output->write(anything_to_string(globals->get_variable("line")));
+            output->newline();
+        }
+    }
+};
@@ -1,15 +1,18 @@
 #include "includes/Scope.hpp"
+#include "includes/AST/AST_ClassDefinition.hpp"
 
 
 Scope::Scope(std::string name) {
     this->name = name;
     this->value = 0;
+    this->slot = 0;
 };
 
 Scope::~Scope() {
     this->variables.clear();
     this->function_definitions.clear();
     this->builtin_functions.clear();
+    this->classes.clear();
     this->name = "";
     this->value = nullptr;
 };
@@ -26,6 +29,10 @@ void Scope::define_builtin_function(AST_BuiltinFunctionDefinition* udfc) {
     this->builtin_functions.push_back(udfc);
 };
 
+void Scope::define_class(AST_ClassDefinition* definition) {
+    this->classes[definition->name] = definition;
+};
+
 void Scope::free_var(std::string key) {
     this->variables.erase(key);
 };
@@ -56,3 +63,12 @@ AST_BuiltinFunctionDefinition* Scope::get_builtin_function(std::string name) {
 
     return nullptr;
 };
+
+AST_ClassDefinition* Scope::get_class(std::string name) {
+    std::map<std::string, AST_ClassDefinition*>::iterator it = this->classes.find(name);
+
+    if (it == this->classes.end())
+        return nullptr;
+
+    return it->second;
+};
@@ -0,0 +1,201 @@
+#include "includes/Server.hpp"
+#include "includes/RecordLoop.hpp"
+#include "includes/Input.hpp"
+#include "includes/Output.hpp"
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <string.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <iostream>
+
+
+static void report(int fd, std::string message) {
+    message += "\n";
+
+    if (write(fd, message.data(), message.size()) < 0)
+        return;
+};
+
+Server::Server(std::string path) {
+    this->path = path;
+    this->cwd = -1;
+
+    for (int i = 0; i < 3; i++)
+        this->saved_fds[i] = -1;
+};
+
+Server::~Server() {
+    // programs are kept, freeing an AST is not supported
+    for (int i = 0; i < 3; i++)
+        if (this->saved_fds[i] >= 0)
+            close(this->saved_fds[i]);
+
+    if (this->cwd >= 0)
+        close(this->cwd);
+};
+
+int Server::serve() {
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (this->path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "socket path too long: " << this->path << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    strcpy(address.sun_path, this->path.c_str());
+
+    int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    unlink(this->path.c_str());
+
+    if (listener < 0 || bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 128) != 0) {
+        std::cerr << "cannot listen on " << this->path << ": " << strerror(errno) << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    // clients that go away must not take the server with them
+    signal(SIGPIPE, SIG_IGN);
+
+    this->cwd = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    for (int i = 0; i < 3; i++)
+        this->saved_fds[i] = fcntl(i, F_DUPFD_CLOEXEC, 3);
+
+    while (true) {
+        int client = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED || errno == EMFILE || errno == ENFILE)
+                continue;
+
+            std::cerr << "accept failed: " << strerror(errno) << std::endl;
+            close(listener);
+
+            return EXIT_FAILURE;
+        }
+
+        ServerRequest request;
+
+        if (receive_request(client, request)) {
+            int status = this->handle(request);
+
+            for (int i = 0; i < 3; i++)
+                close(request.fds[i]);
+
+            send_status(client, status);
+        }
+
+        close(client);
+    }
+};
+
+Program* Server::compile(const std::string& filename) {
+    char resolved[PATH_MAX];
+    struct stat info;
+
+    if (realpath(filename.c_str(), resolved) == nullptr || stat(resolved, &info) != 0)
+        throw std::runtime_error("cannot open " + filename + ": " + strerror(errno));
+
+    std::map<std::string, CachedProgram*>::iterator it = this->programs.find(resolved);
+
+    if (it != this->programs.end()) {
+        CachedProgram* cached = it->second;
+
+        if (cached->mtime == info.st_mtim.tv_sec && cached->mtime_nanoseconds == info.st_mtim.tv_nsec && cached->size == info.st_size)
+            return cached->program;
+    }
+
+    int fd = open(resolved, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        throw std::runtime_error("cannot open " + filename + ": " + strerror(errno));
+
+    std::string source;
+    Input input(fd);
+    input.read_all(source);
+    close(fd);
+
+    // an outdated program is leaked rather than freed, like in main
+    CachedProgram* cached = new CachedProgram();
+    cached->program = new Program(source);
+    cached->mtime = info.st_mtim.tv_sec;
+    cached->mtime_nanoseconds = info.st_mtim.tv_nsec;
+    cached->size = info.st_size;
+
+    this->programs[resolved] = cached;
+
+    return cached->program;
+};
+
+int Server::handle(ServerRequest& request) {
+    Options options;
+    std::string error;
+
+    if (chdir(request.cwd.c_str()) != 0) {
+        error = "cannot change to " + request.cwd + ": " + strerror(errno);
+    } else if (parse_options(request.args, options, error)) {
+        if (!options.serve.empty() || !options.client.empty() || !options.batch.empty())
+            error = "--serve, --client and --batch can not be forwarded";
+        else if (options.filename.empty())
+            error = "no input file";
+    }
+
+    int status = EXIT_FAILURE;
+
+    if (error.empty()) {
+        for (int i = 0; i < 3; i++)
+            dup2(request.fds[i], i);
+
+        status = this->run(options);
+
+        for (int i = 0; i < 3; i++)
+            dup2(this->saved_fds[i], i);
+    } else {
+        report(request.fds[2], error);
+    }
+
+    if (fchdir(this->cwd) != 0)
+        std::cerr << "cannot change back to the server's directory" << std::endl;
+
+    return status;
+};
+
+/**
+ * Runs with the client's descriptors in place of our own.
+ */
+int Server::run(Options& options) {
+    int status = EXIT_SUCCESS;
+
+    Output::standard()->policy = options.has_policy ? options.policy : Output::default_policy(STDOUT_FILENO);
+
+    try {
+        Program* program = this->compile(options.filename);
+        ExecutionContext context(Output::standard());
+        Interpreter interpreter(program, &context);
+
+        if (options.records) {
+            RecordLoop loop(&interpreter, options.print);
+            loop.run(program->tree, options.inputs);
+        } else {
+            interpreter.interpret();
+        }
+    } catch (std::exception& e) {
+        Output::flush_all();
+        report(STDERR_FILENO, e.what());
+        status = EXIT_FAILURE;
+    }
+
+    Output::flush_all();
+
+    return status;
+};
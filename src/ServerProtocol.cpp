@@ -0,0 +1,170 @@
+#include "includes/ServerProtocol.hpp"
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * Requests larger than this are rejected, command lines are short.
+ */
+static const uint32_t MAX_REQUEST_SIZE = 1024 * 1024;
+
+
+static bool write_all(int socket, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t n = send(socket, data, size, MSG_NOSIGNAL);
+
+        if (n < 0 && errno == EINTR)
+            continue;
+
+        if (n <= 0)
+            return false;
+
+        data += n;
+        size -= n;
+    }
+
+    return true;
+};
+
+static bool read_all(int socket, char* data, size_t size) {
+    while (size > 0) {
+        ssize_t n = recv(socket, data, size, 0);
+
+        if (n < 0 && errno == EINTR)
+            continue;
+
+        if (n <= 0)
+            return false;
+
+        data += n;
+        size -= n;
+    }
+
+    return true;
+};
+
+/**
+ * The payload is the working directory followed by the arguments,
+ * each terminated by a NUL, after its 32 bit length. The descriptors
+ * are attached to the first byte.
+ */
+bool send_request(int socket, const ServerRequest& request) {
+    std::string payload = request.cwd;
+    payload += '\0';
+
+    for (size_t i = 0; i < request.args.size(); i++) {
+        payload += request.args[i];
+        payload += '\0';
+    }
+
+    uint32_t size = payload.size();
+    char control[CMSG_SPACE(sizeof(request.fds))];
+    memset(control, 0, sizeof(control));
+
+    struct iovec iov;
+    iov.iov_base = &size;
+    iov.iov_len = sizeof(size);
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(request.fds));
+    memcpy(CMSG_DATA(header), request.fds, sizeof(request.fds));
+
+    ssize_t n;
+
+    do {
+        n = sendmsg(socket, &message, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+
+    if (n != sizeof(size))
+        return false;
+
+    return write_all(socket, payload.data(), payload.size());
+};
+
+bool receive_request(int socket, ServerRequest& request) {
+    uint32_t size = 0;
+    char control[CMSG_SPACE(sizeof(request.fds))];
+
+    struct iovec iov;
+    iov.iov_base = &size;
+    iov.iov_len = sizeof(size);
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t n;
+
+    do {
+        n = recvmsg(socket, &message, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+    } while (n < 0 && errno == EINTR);
+
+    struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+    bool passed = header != nullptr && header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS
+        && header->cmsg_len == CMSG_LEN(sizeof(request.fds));
+
+    if (passed)
+        memcpy(request.fds, CMSG_DATA(header), sizeof(request.fds));
+
+    std::vector<char> payload;
+    bool ok = passed && n == sizeof(size) && size > 0 && size <= MAX_REQUEST_SIZE;
+
+    if (ok) {
+        payload.resize(size);
+        ok = read_all(socket, payload.data(), size) && payload[size - 1] == '\0';
+    }
+
+    if (!ok) {
+        if (passed)
+            for (int i = 0; i < 3; i++)
+                close(request.fds[i]);
+
+        return false;
+    }
+
+    const char* it = payload.data();
+    const char* end = it + size;
+
+    request.cwd = it;
+    it += request.cwd.size() + 1;
+    request.args.clear();
+
+    while (it < end) {
+        request.args.push_back(std::string(it));
+        it += request.args.back().size() + 1;
+    }
+
+    return true;
+};
+
+bool send_status(int socket, int status) {
+    int32_t value = status;
+
+    return write_all(socket, (const char*)&value, sizeof(value));
+};
+
+bool receive_status(int socket, int& status) {
+    int32_t value;
+
+    if (!read_all(socket, (char*)&value, sizeof(value)))
+        return false;
+
+    status = value;
+
+    return true;
+};
@@ -0,0 +1,56 @@
+#include "includes/StringSearch.hpp"
+#include "includes/simd.hpp"
+#include <string.h>
+
+
+StringSearch::StringSearch(const std::string& haystack, const std::string& needle, bool text) {
+    this->haystack = &haystack;
+    this->needle = &needle;
+
+    if (text) {
+        this->folded_haystack = string_lower(haystack);
+        this->folded_needle = string_lower(needle);
+        this->haystack = &this->folded_haystack;
+        this->needle = &this->folded_needle;
+    }
+};
+
+size_t StringSearch::find(size_t from) {
+    if (from > this->haystack->size())
+        return std::string::npos;
+
+    const char* start = this->haystack->data();
+    const char* found = simd_find(start + from, this->haystack->size() - from, this->needle->data(), this->needle->size());
+
+    return found == nullptr ? std::string::npos : found - start;
+};
+
+size_t StringSearch::needle_length() {
+    return this->needle->size();
+};
+
+std::string string_lower(const std::string& value) {
+    std::string result(value.size(), '\0');
+    simd_lower(&result[0], value.data(), value.size());
+
+    return result;
+};
+
+std::string string_upper(const std::string& value) {
+    std::string result(value.size(), '\0');
+    simd_upper(&result[0], value.data(), value.size());
+
+    return result;
+};
+
+int string_compare(const std::string& left, const std::string& right, bool text) {
+    size_t length = left.size() < right.size() ? left.size() : right.size();
+    int result = text ?
+        simd_compare_folded(left.data(), right.data(), length) :
+        memcmp(left.data(), right.data(), length);
+
+    if (result == 0)
+        result = left.size() < right.size() ? -1 : left.size() > right.size() ? 1 : 0;
+
+    return result < 0 ? -1 : result > 0 ? 1 : 0;
+};
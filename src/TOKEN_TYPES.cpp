@@ -0,0 +1,39 @@
+#include "includes/TOKEN_TYPES.hpp"
+
+
+const std::map<std::string, TokenType> RESERVED_KEYWORDS = {
+    {"end", TokenType::End},
+    {"dim", TokenType::Declare},
+    {"redim", TokenType::Redim},
+    {"preserve", TokenType::Preserve},
+    {"if", TokenType::If},
+    {"else", TokenType::Else},
+    {"elseif", TokenType::Else_if},
+    {"then", TokenType::Then},
+    {"function", TokenType::Function_definition},
+    {"sub", TokenType::Function_definition},
+    {"class", TokenType::Class},
+    {"public", TokenType::Public},
+    {"private", TokenType::Private},
+    {"property", TokenType::Property},
+    {"new", TokenType::New},
+    {"me", TokenType::Me},
+    {"set", TokenType::Set},
+    {"with", TokenType::With},
+    {"do", TokenType::Do},
+    {"loop", TokenType::Loop},
+    {"while", TokenType::While},
+    {"for", TokenType::For},
+    {"each", TokenType::Each},
+    {"in", TokenType::In},
+    {"next", TokenType::Next},
+    {"empty", TokenType::Empty},
+    {"as", TokenType::As},
+    {"print", TokenType::Function_call},
+    {"wscript", TokenType::Object},
+    {"createobject", TokenType::Function_call},
+    {"array", TokenType::Function_call},
+    {"ubound", TokenType::Function_call},
+    {"split", TokenType::Function_call},
+    {"isempty", TokenType::Function_call}
+};
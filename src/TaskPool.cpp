@@ -0,0 +1,125 @@
+#include "includes/TaskPool.hpp"
+#include "includes/Interpreter.hpp"
+#include "includes/AST/AST_Array.hpp"
+#include <thread>
+#include <stdlib.h>
+
+
+TaskPool::TaskPool(size_t threads) {
+    this->threads = threads;
+
+    // the workers live as long as the process
+    for (size_t i = 0; i < threads; i++)
+        std::thread(&TaskPool::work, this).detach();
+};
+
+static size_t configured_threads() {
+    const char* configured = getenv("WSCRIPT_TASK_THREADS");
+    int threads = configured != nullptr ? atoi(configured) : (int)std::thread::hardware_concurrency();
+
+    return threads > 0 ? threads : 1;
+};
+
+TaskPool* TaskPool::instance() {
+    static TaskPool* pool = new TaskPool(configured_threads());
+
+    return pool;
+};
+
+void TaskPool::submit(Task* task) {
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        task->state = Task::Queued;
+        this->tasks.push_back(task);
+    }
+
+    this->queued.notify_one();
+};
+
+void TaskPool::wait(Task* task) {
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    if (task->state == Task::Queued) {
+        // stays in `tasks`, the worker that takes it skips it
+        task->state = Task::Running;
+        guard.unlock();
+
+        ExecutionContext context(task->output, task->errors);
+        this->run(task, &context);
+
+        guard.lock();
+        task->state = Task::Done;
+        this->finished.notify_all();
+
+        return;
+    }
+
+    while (task->state != Task::Done)
+        this->finished.wait(guard);
+};
+
+bool TaskPool::done(Task* task) {
+    std::lock_guard<std::mutex> guard(this->lock);
+
+    return task->state == Task::Done;
+};
+
+void TaskPool::work() {
+    // builtins are set up once per worker, not once per task
+    ExecutionContext context(nullptr, nullptr);
+
+    while (true) {
+        Task* task;
+
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+
+            while (this->tasks.empty())
+                this->queued.wait(guard);
+
+            task = this->tasks.front();
+            this->tasks.pop_front();
+
+            if (task->state != Task::Queued)
+                continue;
+
+            task->state = Task::Running;
+        }
+
+        context.reset(task->output, task->errors);
+        this->run(task, &context);
+
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            task->state = Task::Done;
+        }
+
+        this->finished.notify_all();
+    }
+};
+
+/**
+ * Calls the task's function like a call from the script would, with the
+ * arguments it was submitted with.
+ */
+void TaskPool::run(Task* task, ExecutionContext* context) {
+    context->restore(*task->snapshot);
+    delete task->snapshot;
+    task->snapshot = nullptr;
+
+    try {
+
+        Interpreter interpreter(task->program, context);
+        AST_FunctionDefinition* definition = task->definition;
+        Scope* frame = context->frame(definition->scope);
+
+        for (size_t i = 0; i < definition->args.size(); i++)
+            frame->set_variable(definition->args[i]->value, task->args[i]);
+
+        frame->value = AST_Array::empty_item();
+        interpreter.visit(definition->body);
+        task->result = frame->value;
+    } catch (std::exception& e) {
+        task->error = e.what();
+    }
+};
@@ -1,4 +1,6 @@
 #include "includes/Token.hpp"
+#include "includes/numconv.hpp"
+#include <stdexcept>
 
 
 Token::Token(TokenType type, std::string value) {
@@ -15,9 +17,21 @@ std::string Token::get_string() {
 };
 
 int Token::get_integer() {
-    return std::stoi(this->value);
+    int value = 0;
+    const char* first = this->value.data();
+    const char* last = first + this->value.size();
+
+    if (parse_int(first, last, value) != last)
+        throw std::runtime_error("Overflow: `" + this->value + "`");
+
+    return value;
 };
 
 float Token::get_float() {
-    return std::stof(this->value);
+    double value = 0;
+    const char* first = this->value.data();
+
+    parse_double(first, first + this->value.size(), value);
+
+    return (float)value;
 };
@@ -1,65 +1,115 @@
 #include "includes/cout.hpp"
+#include "includes/Output.hpp"
 #include "includes/AST/AST_Empty.hpp"
-#include <sstream>
+#include "includes/numconv.hpp"
+#include <stdio.h>
+#include <ctype.h>
 
 
-void coutprint_char(char value) {
-    std::stringstream ss;
-    std::string target;
-    ss << value;
-    ss >> target;
-    std::cout << target << std::endl;
+/**
+ * Values are formatted straight into the output buffer, see Output.
+ */
+
+static void write_value(Output* out, anything value);
+
+static void write_array(Output* out, AST_Array* value) {
+    // TODO: implement better "to string" method for this
+
+    out->put('[');
+    out->newline();
+
+    for (unsigned int i = 0; i < value->size(); i++) {
+        write_value(out, value->get(i));
+        out->newline();
+        out->put(',');
+        out->newline();
+    }
+
+    out->put(']');
 };
 
-void coutprint(anything value) {
-    if (value.type() == typeid(std::string))
-        coutprint(boost::get<std::string>(value));
-    else if (value.type() == typeid(char))
-        coutprint_char((char)boost::get<char>(value));
-    else if (value.type() == typeid(int))
-        coutprint(boost::get<int>(value));
+static void write_int(Output* out, int value) {
+    char* start = out->reserve(NUMBER_BUFFER_SIZE);
+
+    out->commit(format_int(start, value) - start);
+};
+
+static void write_float(Output* out, float value) {
+    char* start = out->reserve(NUMBER_BUFFER_SIZE);
+
+    out->commit(format_float(start, value) - start);
+};
+
+static void write_pointer(Output* out, AST* value) {
+    out->commit(snprintf(out->reserve(32), 32, "%p", (void*)value));
+};
+
+static void write_ast(Output* out, AST* value) {
+    if (dynamic_cast<AST_Empty*>(value))
+        out->write("Empty", 5);
+    else if (dynamic_cast<AST_Array*>(value))
+        write_array(out, (AST_Array*)value);
+    else
+        write_pointer(out, value);
+};
+
+static void write_value(Output* out, anything value) {
+    if (std::string* str = boost::get<std::string>(&value))
+        out->write(*str);
+    else if (value.type() == typeid(char)) {
+        // whitespace used to be dropped by reading it back from a stream
+        char c = boost::get<char>(value);
+
+        if (!isspace((unsigned char)c))
+            out->put(c);
+    } else if (value.type() == typeid(int))
+        write_int(out, boost::get<int>(value));
     else if (value.type() == typeid(float))
-        coutprint(boost::get<float>(value));
+        write_float(out, boost::get<float>(value));
     else if (value.type() == typeid(bool))
-        coutprint(boost::get<bool>(value));
+        out->put(boost::get<bool>(value) ? '1' : '0');
     else if (value.type() == typeid(AST*))
-        coutprint(boost::get<AST*>(value));
+        write_ast(out, boost::get<AST*>(value));
     else
-        std::cout << "anything" << std::endl;
+        out->write("anything", 8);
+};
+
+void coutprint_char(char value) {
+    coutprint(anything(value));
+};
+
+void coutprint(anything value) {
+    coutprint(Output::standard(), value);
+};
+
+void coutprint(Output* out, anything value) {
+    write_value(out, value);
+    out->newline();
 };
 
 void coutprint(std::string value) {
-    std::cout << value << std::endl;
+    Output* out = Output::standard();
+
+    out->write(value);
+    out->newline();
 };
 
 void coutprint(int value) {
-    std::cout << value << std::endl;
+    coutprint(anything(value));
 };
 
 void coutprint(float value) {
-    std::cout << value << std::endl;
+    coutprint(anything(value));
 };
 
 void coutprint(bool value) {
-    std::cout << value << std::endl;
+    coutprint(anything(value));
 };
 
 void coutprint(AST* value) {
-    if (dynamic_cast<AST_Empty*>(value))
-        std::cout << "Empty" << std::endl;
-    else if (dynamic_cast<AST_Array*>(value))
-        coutprint((AST_Array*)value);
-    else
-        std::cout << value << std::endl;
+    coutprint(anything(value));
 };
 
 void coutprint(AST_Array* value) {
-    // TODO: implement better "to string" method for this
-    
-    std::cout << "[" << std::endl;
-    for (unsigned int i = 0; i < value->items.size(); i++) {
-        coutprint(value->items[i]);
-        std::cout << "," << std::endl;
-    }
-    std::cout << "]" << std::endl;
+    coutprint(anything((AST*)value));
 };
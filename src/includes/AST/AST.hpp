@@ -11,12 +11,17 @@ class AST {
         virtual ~AST()
         {}
 
+        /**
+         * Set by the parser and never changed by running the node, a run
+         * finds its own copy through ExecutionContext::frame.
+         * nullptr stands for the global scope.
+         */
         Scope* scope = nullptr;
-        Scope* private_scope = nullptr;
         Scope* parent_scope = nullptr;
 
-        Scope* get_scope();
-        Scope* get_parent_scope();
+        /* state of runtime objects, such as extension instances */
+        Scope* private_scope = nullptr;
+
         Scope* get_private_scope();
 };
 #endif
@@ -9,10 +9,43 @@
 class AST_Array: public AST {
     public:
         AST_Array(Token* token);
-        ~AST_Array();
+        virtual ~AST_Array();
 
         Token* token;
 
+        /**
+         * All elements live in `items`, multi-dimensional arrays are stored
+         * in row-major order.
+         * An empty `dimensions` means a one dimensional array
+         * of `size()` elements.
+         *
+         * Typed arrays (AST_TypedArray) keep their elements in a native
+         * buffer instead, so elements should be accessed through
+         * `get` / `set` unless the array is known to be a variant array.
+         */
         std::vector<anything> items;
+        std::vector<int> dimensions;
+
+        int get_dimension_count();
+        int get_length(int dimension);
+        int get_bound(int dimension);
+        int get_offset(std::vector<int> indices);
+
+        virtual TokenType get_element_type();
+        virtual size_t size();
+        virtual anything get(int offset);
+        virtual void set(int offset, anything value);
+        virtual void redim(std::vector<int> dimensions, bool preserve);
+        virtual bool next(size_t& cursor, anything& value);
+
+        virtual const double* numeric_data(std::vector<double>& scratch, bool& integral);
+
+        /**
+         * @return AST_Array* - a new array with the same elements, of the
+         * same element type.
+         */
+        virtual AST_Array* copy();
+
+        static AST* empty_item();
 };
 #endif
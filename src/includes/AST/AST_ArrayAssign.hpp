@@ -0,0 +1,22 @@
+#ifndef AST_ARRAY_ASSIGN_H
+#define AST_ARRAY_ASSIGN_H
+#include "AST.hpp"
+#include "../Token.hpp"
+#include <vector>
+#include <string>
+
+
+class AST_ArrayAssign: public AST {
+    public:
+        AST_ArrayAssign(std::string name, std::vector<AST*> args, Token* op, AST* right);
+        ~AST_ArrayAssign();
+
+        std::string name;
+
+        std::vector<AST*> args;
+
+        Token* op;
+
+        AST* right;
+};
+#endif
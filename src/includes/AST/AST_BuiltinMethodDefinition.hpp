@@ -0,0 +1,22 @@
+#ifndef AST_BUILT_IN_METHODDEFINITION_H
+#define AST_BUILT_IN_METHODDEFINITION_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+
+
+/**
+ * A native method of a builtin object class.
+ *
+ * One instance exists per class and method (see MethodTable),
+ * the object it is called on is passed as `self`.
+ */
+class AST_BuiltinMethodDefinition: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_BuiltinMethodDefinition(std::string name);
+        virtual ~AST_BuiltinMethodDefinition()
+        {}
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+
+        virtual AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter) = 0;
+};
+#endif
@@ -0,0 +1,67 @@
+#ifndef AST_CLASS_DEFINITION_H
+#define AST_CLASS_DEFINITION_H
+#include "AST.hpp"
+#include "AST_FunctionDefinition.hpp"
+#include "../MethodTable.hpp"
+#include "../TokenType.hpp"
+#include <vector>
+#include <map>
+
+
+class AST_ClassMethod;
+
+/**
+ * `Class name ... End Class`
+ *
+ * The layout is fixed when the class is parsed: every field gets a slot,
+ * instances (AST_ClassInstance) store their fields in a flat vector
+ * indexed by slot, and code inside the class accesses fields by slot.
+ *
+ * Public methods and properties are shared by all instances
+ * through `methods`.
+ */
+class AST_ClassDefinition: public AST {
+    public:
+        AST_ClassDefinition(std::string name);
+        ~AST_ClassDefinition();
+
+        std::string name;
+
+        /* field names and visibility, in slot order */
+        std::vector<std::string> fields;
+        std::vector<bool> public_fields;
+
+        /* array fields and their dimensions, typed fields */
+        std::map<std::string, std::vector<AST*> > arrays;
+        std::map<std::string, TokenType> types;
+
+        /* every method and property, public or private */
+        std::vector<AST_FunctionDefinition*> definitions;
+
+        /* `Class_Initialize`, nullptr if the class has none */
+        AST_FunctionDefinition* initialize;
+
+        MethodTable methods;
+
+        /**
+         * @return int - the slot of the field, an existing field keeps
+         * its slot.
+         */
+        int add_field(std::string name, bool is_public);
+
+        /**
+         * @return int - the slot of the field, -1 if there is no such
+         * field or it is private and `include_private` is false.
+         */
+        int get_slot(Atom name, bool include_private);
+
+        void add_method(AST_FunctionDefinition* definition, bool is_public);
+        void add_property(AST_FunctionDefinition* definition, bool setter, bool is_public);
+
+    private:
+        std::map<Atom, int> slots;
+        std::map<Atom, AST_ClassMethod*> members;
+
+        AST_ClassMethod* member(std::string name);
+};
+#endif
@@ -0,0 +1,24 @@
+#ifndef AST_CLASS_INSTANCE_H
+#define AST_CLASS_INSTANCE_H
+#include "AST_Object.hpp"
+#include "AST_ClassDefinition.hpp"
+#include "../typedefs.hpp"
+#include <vector>
+
+
+/**
+ * An object created with `New`, its fields are stored by slot
+ * (see AST_ClassDefinition).
+ */
+class AST_ClassInstance: public AST_Object {
+    public:
+        AST_ClassInstance(AST_ClassDefinition* definition);
+        ~AST_ClassInstance();
+
+        AST_ClassDefinition* definition;
+
+        std::vector<anything> slots;
+
+        MethodTable* get_method_table();
+};
+#endif
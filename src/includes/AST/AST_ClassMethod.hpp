@@ -0,0 +1,24 @@
+#ifndef AST_CLASS_METHOD_H
+#define AST_CLASS_METHOD_H
+#include "AST_BuiltinMethodDefinition.hpp"
+#include "AST_FunctionDefinition.hpp"
+
+
+/**
+ * Entry of a user defined class in its MethodTable.
+ *
+ * Methods only have a `getter`, properties have a `getter` (Property Get)
+ * and/or a `setter` (Property Let / Set), which receives the assigned
+ * value as its last argument.
+ */
+class AST_ClassMethod: public AST_BuiltinMethodDefinition {
+    public:
+        AST_ClassMethod(std::string name);
+        ~AST_ClassMethod();
+
+        AST_FunctionDefinition* getter;
+        AST_FunctionDefinition* setter;
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,17 @@
+#ifndef AST_FOR_EACH_H
+#define AST_FOR_EACH_H
+#include "AST.hpp"
+#include "AST_Compound.hpp"
+#include "../Token.hpp"
+
+
+class AST_ForEach: public AST {
+    public:
+        AST_ForEach(Token* var, AST* group, AST_Compound* body);
+        ~AST_ForEach();
+
+        Token* var;
+        AST* group;
+        AST_Compound* body;
+};
+#endif
@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_AGGREGATE_H
+#define AST_FUNCTION_AGGREGATE_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * Sum, Min, Max and Avg over the elements of a numeric array,
+ * the reduction is selected by the name the function is registered with.
+ */
+class AST_Function_Aggregate: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Aggregate(std::string name);
+        ~AST_Function_Aggregate();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_CDBL_H
+#define AST_FUNCTION_CDBL_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * Converts a value to a number, or every element of an array
+ * into a `Double` array in one pass.
+ */
+class AST_Function_CDbl: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_CDbl(std::string name);
+        ~AST_Function_CDbl();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,17 @@
+#ifndef AST_FUNCTION_CINT_H
+#define AST_FUNCTION_CINT_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * Converts a value to an `Integer`, rounding half to even.
+ */
+class AST_Function_CInt: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_CInt(std::string name);
+        ~AST_Function_CInt();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
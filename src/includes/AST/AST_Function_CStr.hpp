@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_CSTR_H
+#define AST_FUNCTION_CSTR_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * Converts a value to a string, numbers are formatted the same way
+ * `print` formats them.
+ */
+class AST_Function_CStr: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_CStr(std::string name);
+        ~AST_Function_CStr();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,17 @@
+#ifndef AST_FUNCTION_CHANGECASE_H
+#define AST_FUNCTION_CHANGECASE_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * LCase and UCase, selected by the name the function is registered with.
+ */
+class AST_Function_ChangeCase: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_ChangeCase(std::string name);
+        ~AST_Function_ChangeCase();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -13,5 +13,7 @@ class AST_Function_CreateObject: public AST_BuiltinFunctionDefinition {
         AST* call(std::vector<AST*> args, Interpreter* interpreter);
 
         AST_Object* obj;
+
+        static bool is_builtin_class(std::string name);
 };
 #endif
@@ -0,0 +1,14 @@
+#ifndef AST_FUNCTION_DOT_H
+#define AST_FUNCTION_DOT_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+class AST_Function_Dot: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Dot(std::string name);
+        ~AST_Function_Dot();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_FILTER_H
+#define AST_FUNCTION_FILTER_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `Filter(strings, value[, include[, compare]])`, the elements of an
+ * array that contain (or with include 0, do not contain) value.
+ */
+class AST_Function_Filter: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Filter(std::string name);
+        ~AST_Function_Filter();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_INSTR_H
+#define AST_FUNCTION_INSTR_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `InStr([start, ]string1, string2[, compare])`, the 1 based position
+ * of string2 in string1 or 0.
+ */
+class AST_Function_InStr: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_InStr(std::string name);
+        ~AST_Function_InStr();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_JOIN_H
+#define AST_FUNCTION_JOIN_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `Join(list[, delimiter])`, the result is sized exactly before any
+ * element is copied into it.
+ */
+class AST_Function_Join: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Join(std::string name);
+        ~AST_Function_Join();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,17 @@
+#ifndef AST_FUNCTION_MID_H
+#define AST_FUNCTION_MID_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `Mid(string, start[, length])`
+ */
+class AST_Function_Mid: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Mid(std::string name);
+        ~AST_Function_Mid();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
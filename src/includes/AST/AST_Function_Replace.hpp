@@ -0,0 +1,18 @@
+#ifndef AST_FUNCTION_REPLACE_H
+#define AST_FUNCTION_REPLACE_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `Replace(expression, find, replacewith[, start[, count[, compare]]])`
+ * in a single pass over expression.
+ */
+class AST_Function_Replace: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_Replace(std::string name);
+        ~AST_Function_Replace();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
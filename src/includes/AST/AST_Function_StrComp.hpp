@@ -0,0 +1,17 @@
+#ifndef AST_FUNCTION_STRCOMP_H
+#define AST_FUNCTION_STRCOMP_H
+#include "AST_BuiltinFunctionDefinition.hpp"
+#include "../Interpreter.hpp"
+
+
+/**
+ * `StrComp(string1, string2[, compare])`, -1, 0 or 1.
+ */
+class AST_Function_StrComp: public AST_BuiltinFunctionDefinition {
+    public:
+        AST_Function_StrComp(std::string name);
+        ~AST_Function_StrComp();
+
+        AST* call(std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,11 @@
+#ifndef AST_ME_H
+#define AST_ME_H
+#include "AST.hpp"
+
+
+class AST_Me: public AST {
+    public:
+        AST_Me();
+        ~AST_Me();
+};
+#endif
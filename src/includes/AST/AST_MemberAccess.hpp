@@ -0,0 +1,45 @@
+#ifndef AST_MEMBER_ACCESS_H
+#define AST_MEMBER_ACCESS_H
+#include "AST.hpp"
+#include "../intern.hpp"
+#include "../InlineCache.hpp"
+#include <vector>
+
+
+/**
+ * `object.member` in all of its forms:
+ *
+ *     obj.Count               Get
+ *     obj.Add(k, v)           Call
+ *     obj.CompareMode = 1     Let
+ *     obj.Item(k) = v         CallLet
+ *
+ * The node is not modified while it is being interpreted,
+ * apart from its inline cache.
+ */
+class AST_MemberAccess: public AST {
+    public:
+        enum Kind { Get, Call, Let, CallLet };
+
+        AST_MemberAccess(AST* object, std::string member, Kind kind, std::vector<AST*> args, AST* value);
+        ~AST_MemberAccess();
+
+        AST* object;
+
+        /* the name as written and its interned, lowercased form */
+        std::string member;
+        Atom name;
+
+        Kind kind;
+        std::vector<AST*> args;
+        AST* value;
+
+        InlineCache cache;
+
+        /**
+         * @return std::vector<AST*> - the arguments a method receives,
+         * the assigned value comes last.
+         */
+        std::vector<AST*> call_args();
+};
+#endif
@@ -0,0 +1,21 @@
+#ifndef AST_NATIVE_METHOD_H
+#define AST_NATIVE_METHOD_H
+#include "AST_BuiltinMethodDefinition.hpp"
+#include "../wscript_extension.h"
+
+
+/**
+ * Adapts an entry of a native extension's method table, arguments are
+ * evaluated and passed as ws_values, the returned ws_value is converted
+ * back without going through a token.
+ */
+class AST_NativeMethod: public AST_BuiltinMethodDefinition {
+    public:
+        AST_NativeMethod(const ws_method* method);
+        ~AST_NativeMethod();
+
+        const ws_method* method;
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_NEW_H
+#define AST_NEW_H
+#include "AST.hpp"
+#include <string>
+
+
+class AST_New: public AST {
+    public:
+        AST_New(std::string name);
+        ~AST_New();
+
+        std::string name;
+};
+#endif
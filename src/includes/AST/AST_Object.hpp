@@ -2,6 +2,7 @@
 #define AST_OBJECT_H
 #include "AST.hpp"
 #include "../Token.hpp"
+#include "../MethodTable.hpp"
 
 
 class AST_Object: public AST {
@@ -10,5 +11,12 @@ class AST_Object: public AST {
         ~AST_Object();
 
         Token* token;
+
+        /**
+         * @return MethodTable* - the methods shared by all instances of
+         * the class, nullptr for objects that keep their methods in
+         * `private_scope`.
+         */
+        virtual MethodTable* get_method_table();
 };
 #endif
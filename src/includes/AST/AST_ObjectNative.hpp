@@ -0,0 +1,22 @@
+#ifndef AST_OBJECT_NATIVE_H
+#define AST_OBJECT_NATIVE_H
+#include "AST_Object.hpp"
+#include "../NativeModule.hpp"
+
+
+/**
+ * An instance of a class implemented by a native extension,
+ * `self` is the pointer returned by the module's `create`.
+ */
+class AST_ObjectNative: public AST_Object {
+    public:
+        AST_ObjectNative(NativeModule* module);
+        ~AST_ObjectNative();
+
+        NativeModule* module;
+
+        void* self;
+
+        MethodTable* get_method_table();
+};
+#endif
@@ -0,0 +1,22 @@
+#ifndef AST_REDIM_H
+#define AST_REDIM_H
+#include "AST.hpp"
+#include "../Token.hpp"
+#include <vector>
+#include <map>
+
+
+class AST_ReDim: public AST {
+    public:
+        AST_ReDim(std::vector<Token*> tokens, std::map<std::string, std::vector<AST*> > arrays, std::map<std::string, TokenType> types, bool preserve);
+        ~AST_ReDim();
+
+        std::vector<Token*> tokens;
+
+        std::map<std::string, std::vector<AST*> > arrays;
+
+        std::map<std::string, TokenType> types;
+
+        bool preserve;
+};
+#endif
@@ -0,0 +1,21 @@
+#ifndef AST_SLOT_ACCESS_H
+#define AST_SLOT_ACCESS_H
+#include "AST.hpp"
+#include <vector>
+#include <string>
+
+
+/**
+ * A field of the current object (`Me`), inside a class.
+ * `field` or `field(i, ...)` for array fields.
+ */
+class AST_SlotAccess: public AST {
+    public:
+        AST_SlotAccess(int slot, std::string name, std::vector<AST*> args);
+        ~AST_SlotAccess();
+
+        int slot;
+        std::string name;
+        std::vector<AST*> args;
+};
+#endif
@@ -0,0 +1,21 @@
+#ifndef AST_SLOT_ASSIGN_H
+#define AST_SLOT_ASSIGN_H
+#include "AST.hpp"
+#include <vector>
+#include <string>
+
+
+/**
+ * `field = value` or `field(i, ...) = value` inside a class.
+ */
+class AST_SlotAssign: public AST {
+    public:
+        AST_SlotAssign(int slot, std::string name, std::vector<AST*> args, AST* value);
+        ~AST_SlotAssign();
+
+        int slot;
+        std::string name;
+        std::vector<AST*> args;
+        AST* value;
+};
+#endif
@@ -0,0 +1,70 @@
+#ifndef AST_TYPED_ARRAY_H
+#define AST_TYPED_ARRAY_H
+#include "AST_Array.hpp"
+#include "../TokenType.hpp"
+#include <vector>
+#include <string>
+
+
+/**
+ * An array declared with a type, `Dim a(n) As Double`.
+ *
+ * The elements are stored unboxed in a contiguous native buffer,
+ * values are converted from and to `anything` when they are accessed.
+ */
+template <class T>
+class AST_TypedArray: public AST_Array {
+    public:
+        AST_TypedArray(Token* token, TokenType element_type);
+        ~AST_TypedArray();
+
+        TokenType element_type;
+
+        std::vector<T> values;
+
+        TokenType get_element_type();
+        size_t size();
+        anything get(int offset);
+        void set(int offset, anything value);
+        void redim(std::vector<int> dimensions, bool preserve);
+
+        const double* numeric_data(std::vector<double>& scratch, bool& integral);
+
+        AST_Array* copy();
+
+        static T from_anything(anything value);
+        static anything to_anything(T value);
+};
+
+/**
+ * Converts a value to a number the way VBScript does when a value is
+ * stored in a numeric variable, strings have to be numeric.
+ *
+ * @throws std::runtime_error - Type mismatch
+ */
+double anything_to_number(anything value);
+
+/**
+ * Converts a number to an integer rounding half to even, like CLng.
+ *
+ * @throws std::runtime_error - Type mismatch
+ */
+int anything_to_int(anything value);
+
+/**
+ * Converts a value to a string the way CStr does, Empty becomes "".
+ *
+ * @throws std::runtime_error - Type mismatch for arrays and objects
+ */
+std::string anything_to_string(anything value);
+
+/**
+ * Creates an empty array that stores elements of `element_type`.
+ *
+ * @param TokenType element_type - Double, Single, Long, Integer, Byte,
+ * Boolean or String.
+ *
+ * @return AST_Array* - nullptr if the type cannot be stored unboxed.
+ */
+AST_Array* new_typed_array(TokenType element_type);
+#endif
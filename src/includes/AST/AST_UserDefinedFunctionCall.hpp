@@ -14,10 +14,12 @@ class AST_UserDefinedFunctionCall: public AST_FunctionCall {
         AST_UserDefinedFunctionCall(std::vector<AST*> args, std::string name);
         ~AST_UserDefinedFunctionCall();
 
-        AST_FunctionDefinition* definition;
-
         std::string name;
 
+        /**
+         * @return AST* - the body of the function being called in the
+         * interpreter's run, a NoOp if it is not defined.
+         */
         AST* call(Interpreter* interpreter);
 };
 #endif
@@ -0,0 +1,20 @@
+#ifndef AST_VALUE_H
+#define AST_VALUE_H
+#include "AST.hpp"
+#include "../typedefs.hpp"
+
+
+/**
+ * An already evaluated value.
+ *
+ * Used by builtin functions to return results without encoding them
+ * into a token that has to be parsed again.
+ */
+class AST_Value: public AST {
+    public:
+        AST_Value(anything value);
+        ~AST_Value();
+
+        anything value;
+};
+#endif
@@ -3,13 +3,20 @@
 #include "AST.hpp"
 #include "../Token.hpp"
 #include <vector>
+#include <map>
 
 
 class AST_VarDecl: public AST {
     public:
-        AST_VarDecl(std::vector<Token*> tokens);
+        AST_VarDecl(std::vector<Token*> tokens, std::map<std::string, std::vector<AST*> > arrays, std::map<std::string, TokenType> types);
         ~AST_VarDecl();
 
         std::vector<Token*> tokens;
+
+        // upper bounds of the variables declared as arrays, `Dim a(n, m)`
+        std::map<std::string, std::vector<AST*> > arrays;
+
+        // element types of arrays declared with `As {type}`
+        std::map<std::string, TokenType> types;
 };
 #endif
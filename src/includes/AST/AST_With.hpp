@@ -0,0 +1,23 @@
+#ifndef AST_WITH_H
+#define AST_WITH_H
+#include "AST.hpp"
+#include "AST_Compound.hpp"
+
+
+/**
+ * `With target ... End With`
+ *
+ * `target` is evaluated once into the interpreter's with-slot `depth`
+ * (the nesting level of the block), `.member` inside the block reads
+ * that slot through AST_WithObject.
+ */
+class AST_With: public AST {
+    public:
+        AST_With(AST* target, AST_Compound* body, int depth);
+        ~AST_With();
+
+        AST* target;
+        AST_Compound* body;
+        int depth;
+};
+#endif
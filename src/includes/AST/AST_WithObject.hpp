@@ -0,0 +1,16 @@
+#ifndef AST_WITH_OBJECT_H
+#define AST_WITH_OBJECT_H
+#include "AST.hpp"
+
+
+/**
+ * The implicit object of `.member` inside a With block.
+ */
+class AST_WithObject: public AST {
+    public:
+        AST_WithObject(int depth);
+        ~AST_WithObject();
+
+        int depth;
+};
+#endif
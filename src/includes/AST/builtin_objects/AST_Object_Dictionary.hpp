@@ -6,6 +6,11 @@
 #include "AST_Object_Dictionary_Keys.hpp"
 #include "AST_Object_Dictionary_Items.hpp"
 #include "AST_Object_Dictionary_RemoveAll.hpp"
+#include "AST_Object_Dictionary_Remove.hpp"
+#include "AST_Object_Dictionary_Item.hpp"
+#include "AST_Object_Dictionary_Count.hpp"
+#include "AST_Object_Dictionary_CompareMode.hpp"
+#include "../../HashTable.hpp"
 
 
 class AST_Object_Dictionary: public AST_Object {
@@ -14,5 +19,11 @@ class AST_Object_Dictionary: public AST_Object {
         ~AST_Object_Dictionary();
 
         Token* token;
+
+        HashTable table;
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
 };
 #endif
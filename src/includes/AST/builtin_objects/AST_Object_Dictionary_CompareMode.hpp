@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_DICT_COMPARE_MODE_H
+#define AST_OBJECT_DICT_COMPARE_MODE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_Dictionary_CompareMode: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_Dictionary_CompareMode(std::string name);
+        ~AST_Object_Dictionary_CompareMode();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
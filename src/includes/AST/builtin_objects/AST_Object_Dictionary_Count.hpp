@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_DICT_COUNT_H
+#define AST_OBJECT_DICT_COUNT_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_Dictionary_Count: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_Dictionary_Count(std::string name);
+        ~AST_Object_Dictionary_Count();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -1,17 +1,14 @@
 #ifndef AST_OBJECT_DICT_EXISTS_H
 #define AST_OBJECT_DICT_EXISTS_H
-#include "../AST_BuiltinFunctionDefinition.hpp"
-#include "../AST_Object.hpp"
+#include "../AST_BuiltinMethodDefinition.hpp"
 #include "../../Interpreter.hpp"
 
 
-class AST_Object_Dictionary_Exists: public AST_BuiltinFunctionDefinition {
+class AST_Object_Dictionary_Exists: public AST_BuiltinMethodDefinition {
     public:
-        AST_Object_Dictionary_Exists(std::string name, AST_Object* obj);
+        AST_Object_Dictionary_Exists(std::string name);
         ~AST_Object_Dictionary_Exists();
 
-        AST* call(std::vector<AST*> args, Interpreter* interpreter);
-
-        AST_Object* obj;
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
 };
 #endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_DICT_ITEM_H
+#define AST_OBJECT_DICT_ITEM_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_Dictionary_Item: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_Dictionary_Item(std::string name);
+        ~AST_Object_Dictionary_Item();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
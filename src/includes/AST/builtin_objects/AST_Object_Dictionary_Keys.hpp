@@ -1,18 +1,15 @@
 #ifndef AST_OBJECT_DICT_KEYS_H
 #define AST_OBJECT_DICT_KEYS_H
-#include "../AST_BuiltinFunctionDefinition.hpp"
-#include "../AST_Object.hpp"
+#include "../AST_BuiltinMethodDefinition.hpp"
 #include "../../Interpreter.hpp"
 #include <map>
 
 
-class AST_Object_Dictionary_Keys: public AST_BuiltinFunctionDefinition {
+class AST_Object_Dictionary_Keys: public AST_BuiltinMethodDefinition {
     public:
-        AST_Object_Dictionary_Keys(std::string name, AST_Object* obj);
+        AST_Object_Dictionary_Keys(std::string name);
         ~AST_Object_Dictionary_Keys();
 
-        AST* call(std::vector<AST*> args, Interpreter* interpreter);
-
-        AST_Object* obj;
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
 };
 #endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_DICT_REMOVE_H
+#define AST_OBJECT_DICT_REMOVE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_Dictionary_Remove: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_Dictionary_Remove(std::string name);
+        ~AST_Object_Dictionary_Remove();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,46 @@
+#ifndef AST_OBJECT_DICT_VIEW_H
+#define AST_OBJECT_DICT_VIEW_H
+#include "../AST_Array.hpp"
+#include "../../HashTable.hpp"
+
+
+/**
+ * The result of `Keys()` and `Items()`.
+ *
+ * The view reads the keys or values straight from the dictionary's
+ * HashTable, so iterating it with `For Each`, printing it or asking for
+ * its size does not copy anything.
+ *
+ * The elements are copied into `items` (see `materialize`) when the view
+ * is stored somewhere or modified, from then on it behaves like a regular
+ * array and no longer follows changes to the dictionary.
+ *
+ * A view that is not stored is only iterated by the loop it was created
+ * for, so it keeps the state of that loop itself.
+ */
+class AST_Object_Dictionary_View: public AST_Array {
+    public:
+        AST_Object_Dictionary_View(HashTable* table, bool values);
+        ~AST_Object_Dictionary_View();
+
+        HashTable* table;
+        bool values;
+        bool materialized;
+
+        /* where the loop stops and goes on, see `next` */
+        size_t end;
+        uint64_t modifications;
+        uint64_t stop_order;
+        uint64_t resume_order;
+
+        void materialize();
+
+        size_t size();
+        anything get(int offset);
+        void set(int offset, anything value);
+        void redim(std::vector<int> dimensions, bool preserve);
+        bool next(size_t& cursor, anything& value);
+
+        const double* numeric_data(std::vector<double>& scratch, bool& integral);
+};
+#endif
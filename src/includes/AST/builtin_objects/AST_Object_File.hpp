@@ -0,0 +1,41 @@
+#ifndef AST_OBJECT_FILE_H
+#define AST_OBJECT_FILE_H
+#include "../AST_Object.hpp"
+#include "AST_Object_File_Name.hpp"
+#include "AST_Object_File_Size.hpp"
+#include <sys/stat.h>
+
+
+/**
+ * A file returned by GetFile or a folder's Files collection.
+ *
+ * Only the path is known up front, attributes are read with `stat`
+ * the first time one of them is asked for.
+ */
+class AST_Object_File: public AST_Object {
+    public:
+        AST_Object_File(std::string path);
+        ~AST_Object_File();
+
+        std::string path;
+
+        /**
+         * @return struct stat* - nullptr if the file can not be stat'ed.
+         */
+        struct stat* attributes();
+
+        /**
+         * @return std::string - the last component of `path`.
+         */
+        std::string name();
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+
+    private:
+        bool loaded;
+        bool found;
+        struct stat info;
+};
+#endif
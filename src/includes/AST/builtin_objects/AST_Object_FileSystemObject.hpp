@@ -0,0 +1,26 @@
+#ifndef AST_OBJECT_FSO_H
+#define AST_OBJECT_FSO_H
+#include "../AST_Object.hpp"
+#include "AST_Object_FileSystemObject_OpenTextFile.hpp"
+#include "AST_Object_FileSystemObject_FileExists.hpp"
+#include "AST_Object_FileSystemObject_DeleteFile.hpp"
+#include "AST_Object_FileSystemObject_GetFolder.hpp"
+#include "AST_Object_FileSystemObject_CreateFolder.hpp"
+
+
+/**
+ * Scripting.FileSystemObject, files are opened as TextStreams and
+ * directories are listed through Folder objects.
+ */
+class AST_Object_FileSystemObject: public AST_Object {
+    public:
+        AST_Object_FileSystemObject(Token* token);
+        ~AST_Object_FileSystemObject();
+
+        Token* token;
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+};
+#endif
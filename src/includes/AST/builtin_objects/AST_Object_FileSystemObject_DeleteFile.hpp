@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_FSO_DELETEFILE_H
+#define AST_OBJECT_FSO_DELETEFILE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_FileSystemObject_DeleteFile: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_FileSystemObject_DeleteFile(std::string name);
+        ~AST_Object_FileSystemObject_DeleteFile();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_FSO_FILEEXISTS_H
+#define AST_OBJECT_FSO_FILEEXISTS_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_FileSystemObject_FileExists: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_FileSystemObject_FileExists(std::string name);
+        ~AST_Object_FileSystemObject_FileExists();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_FILE_NAME_H
+#define AST_OBJECT_FILE_NAME_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_File_Name: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_File_Name(std::string name);
+        ~AST_Object_File_Name();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_FILE_SIZE_H
+#define AST_OBJECT_FILE_SIZE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_File_Size: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_File_Size(std::string name);
+        ~AST_Object_File_Size();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
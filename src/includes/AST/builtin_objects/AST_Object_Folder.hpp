@@ -0,0 +1,19 @@
+#ifndef AST_OBJECT_FOLDER_H
+#define AST_OBJECT_FOLDER_H
+#include "AST_Object_File.hpp"
+#include "AST_Object_Folder_Items.hpp"
+
+
+/**
+ * A folder returned by GetFolder, a SubFolders collection or a walk.
+ */
+class AST_Object_Folder: public AST_Object_File {
+    public:
+        AST_Object_Folder(std::string path);
+        ~AST_Object_Folder();
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+};
+#endif
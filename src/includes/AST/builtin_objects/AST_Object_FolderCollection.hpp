@@ -0,0 +1,54 @@
+#ifndef AST_OBJECT_FOLDERCOLLECTION_H
+#define AST_OBJECT_FOLDERCOLLECTION_H
+#include "../AST_Array.hpp"
+#include "../../DirectoryReader.hpp"
+#include "../../DirectoryWalker.hpp"
+
+
+/**
+ * The result of `Files`, `SubFolders` and `Walk`.
+ *
+ * `For Each` streams the entries straight from the directory, one
+ * File or Folder object at a time, and starts over on every loop.
+ * Everything else (indexing, UBound, printing) reads all entries into
+ * `items` first, like AST_Object_Dictionary_View.
+ */
+class AST_Object_FolderCollection: public AST_Array {
+    public:
+        enum Kind { Files, SubFolders, Walk };
+
+        AST_Object_FolderCollection(std::string path, Kind kind, int threads);
+        ~AST_Object_FolderCollection();
+
+        std::string path;
+        Kind kind;
+
+        /**
+         * Worker threads of a Walk, 0 walks on the calling thread.
+         */
+        int threads;
+
+        bool materialized;
+
+        void materialize();
+
+        size_t size();
+        anything get(int offset);
+        void set(int offset, anything value);
+        void redim(std::vector<int> dimensions, bool preserve);
+        bool next(size_t& cursor, anything& value);
+
+        const double* numeric_data(std::vector<double>& scratch, bool& integral);
+
+    private:
+        DirectoryReader* reader;
+        DirectoryWalker* walker;
+
+        void restart();
+
+        /**
+         * @return AST* - the next File or Folder, nullptr after the last.
+         */
+        AST* read();
+};
+#endif
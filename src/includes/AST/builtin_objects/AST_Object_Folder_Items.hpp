@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_FOLDER_ITEMS_H
+#define AST_OBJECT_FOLDER_ITEMS_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_Folder_Items: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_Folder_Items(std::string name);
+        ~AST_Object_Folder_Items();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
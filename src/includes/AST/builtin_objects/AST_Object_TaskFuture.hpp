@@ -0,0 +1,30 @@
+#ifndef AST_OBJECT_TASKFUTURE_H
+#define AST_OBJECT_TASKFUTURE_H
+#include "../AST_Object.hpp"
+#include "../../TaskPool.hpp"
+#include "AST_Object_TaskFuture_Wait.hpp"
+
+
+class Interpreter;
+
+/**
+ * The result of a function submitted to a WScript.TaskPool.
+ */
+class AST_Object_TaskFuture: public AST_Object {
+    public:
+        AST_Object_TaskFuture(TaskPool::Task* task);
+        ~AST_Object_TaskFuture();
+
+        TaskPool::Task* task;
+
+        /**
+         * Waits for the task and writes what it printed to the output of
+         * `interpreter`, the first time it is called.
+         */
+        void join(Interpreter* interpreter);
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TASKFUTURE_WAIT_H
+#define AST_OBJECT_TASKFUTURE_WAIT_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TaskFuture_Wait: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TaskFuture_Wait(std::string name);
+        ~AST_Object_TaskFuture_Wait();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,33 @@
+#ifndef AST_OBJECT_TASKPOOL_H
+#define AST_OBJECT_TASKPOOL_H
+#include "../AST_Object.hpp"
+#include "AST_Object_TaskFuture.hpp"
+#include "AST_Object_TaskPool_Submit.hpp"
+#include "AST_Object_TaskPool_WaitAll.hpp"
+#include <vector>
+
+
+/**
+ * `CreateObject("WScript.TaskPool")`, runs functions of the script on
+ * the worker threads of the TaskPool:
+ *
+ *     Set pool = CreateObject("WScript.TaskPool")
+ *     Set future = pool.Submit("Checksum", path)
+ *     print(future.Result())
+ *
+ * What a task prints is written when it is waited for, so the output
+ * does not depend on which task finishes first.
+ */
+class AST_Object_TaskPool: public AST_Object {
+    public:
+        AST_Object_TaskPool(Token* token);
+        ~AST_Object_TaskPool();
+
+        /* in the order they were submitted */
+        std::vector<AST_Object_TaskFuture*> futures;
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TASKPOOL_SUBMIT_H
+#define AST_OBJECT_TASKPOOL_SUBMIT_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TaskPool_Submit: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TaskPool_Submit(std::string name);
+        ~AST_Object_TaskPool_Submit();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TASKPOOL_WAITALL_H
+#define AST_OBJECT_TASKPOOL_WAITALL_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TaskPool_WaitAll: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TaskPool_WaitAll(std::string name);
+        ~AST_Object_TaskPool_WaitAll();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
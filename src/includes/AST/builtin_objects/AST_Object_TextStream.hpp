@@ -0,0 +1,82 @@
+#ifndef AST_OBJECT_TEXTSTREAM_H
+#define AST_OBJECT_TEXTSTREAM_H
+#include "../AST_Object.hpp"
+#include "AST_Object_TextStream_Read.hpp"
+#include "AST_Object_TextStream_Write.hpp"
+#include "AST_Object_TextStream_AtEndOfStream.hpp"
+#include "AST_Object_TextStream_Close.hpp"
+#include "../AST_Value.hpp"
+#include "../../Input.hpp"
+#include "../../Output.hpp"
+
+
+/**
+ * An open file, as returned by FileSystemObject.OpenTextFile.
+ *
+ * Reading goes through an Input and writing through an Output, so
+ * neither a line read nor a line written costs a system call of its own.
+ *
+ * WScript.StdIn, StdOut and StdErr are TextStreams as well (see
+ * ExecutionContext::stream), they share their buffers with the rest of
+ * the run and are never closed.
+ */
+class AST_Object_TextStream: public AST_Object {
+    public:
+        enum IOMode { ForReading = 1, ForWriting = 2, ForAppending = 8 };
+
+        AST_Object_TextStream(int fd, IOMode mode);
+        AST_Object_TextStream(Input* input, Output* output);
+        ~AST_Object_TextStream();
+
+        /**
+         * -1 for standard streams, which do not own their file.
+         */
+        int fd;
+
+        IOMode mode;
+
+        /**
+         * nullptr unless the stream is open for reading.
+         */
+        Input* input;
+
+        /**
+         * nullptr unless the stream is open for writing or appending.
+         */
+        Output* output;
+
+        /**
+         * @return Input* - nullptr unless the stream is open for reading.
+         */
+        Input* reader();
+
+        /**
+         * @return Output* - nullptr unless the stream is open for writing.
+         */
+        Output* writer();
+
+        bool closed;
+
+        /**
+         * Results handed back to the interpreter, which copies the value
+         * out right away. ReadLine reads into `line`, so the string's
+         * buffer is reused from line to line.
+         */
+        AST_Value* line;
+        AST_Value* status;
+
+        /**
+         * @return AST_Value* - `status` set to `value`.
+         */
+        AST_Value* result(int value);
+
+        /**
+         * Flushes pending output and closes the file.
+         */
+        void close();
+
+        MethodTable* get_method_table();
+
+        static MethodTable* methods();
+};
+#endif
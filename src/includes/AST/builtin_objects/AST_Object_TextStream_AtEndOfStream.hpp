@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TEXTSTREAM_ATENDOFSTREAM_H
+#define AST_OBJECT_TEXTSTREAM_ATENDOFSTREAM_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TextStream_AtEndOfStream: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TextStream_AtEndOfStream(std::string name);
+        ~AST_Object_TextStream_AtEndOfStream();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
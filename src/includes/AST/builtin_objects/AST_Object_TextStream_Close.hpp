@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TEXTSTREAM_CLOSE_H
+#define AST_OBJECT_TEXTSTREAM_CLOSE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TextStream_Close: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TextStream_Close(std::string name);
+        ~AST_Object_TextStream_Close();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,14 @@
+#ifndef AST_OBJECT_TEXTSTREAM_WRITE_H
+#define AST_OBJECT_TEXTSTREAM_WRITE_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_Object_TextStream_Write: public AST_BuiltinMethodDefinition {
+    public:
+        AST_Object_TextStream_Write(std::string name);
+        ~AST_Object_TextStream_Write();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -2,12 +2,21 @@
 #define AST_WSCRIPT_OBJECT_H
 #include "../AST_Object.hpp"
 #include "AST_WScript_Echo.hpp"
+#include "AST_WScript_Stream.hpp"
 #include <string>
 
 
+/**
+ * The `WScript` object, there is only one per process (see `instance`).
+ */
 class AST_WScript: public AST_Object {
     public:
         AST_WScript(Token* token);
         ~AST_WScript();
+
+        MethodTable* get_method_table();
+
+        static AST_WScript* instance();
+        static MethodTable* methods();
 };
 #endif
@@ -0,0 +1,14 @@
+#ifndef AST_WSCRIPT_STREAM_H
+#define AST_WSCRIPT_STREAM_H
+#include "../AST_BuiltinMethodDefinition.hpp"
+#include "../../Interpreter.hpp"
+
+
+class AST_WScript_Stream: public AST_BuiltinMethodDefinition {
+    public:
+        AST_WScript_Stream(std::string name);
+        ~AST_WScript_Stream();
+
+        AST* call_method(AST* self, std::vector<AST*> args, Interpreter* interpreter);
+};
+#endif
@@ -0,0 +1,117 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+#include "Program.hpp"
+#include "Output.hpp"
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+/**
+ * `wscript.out --batch jobs.txt [-j N]`: runs many scripts in one
+ * process, one script path per line of the jobs file.
+ *
+ * Jobs are dealt round robin to the queues of `threads` workers, which
+ * take their own jobs in order and steal from the other queues once
+ * theirs is empty. Every job runs in an ExecutionContext of its own,
+ * scripts that appear more than once are parsed once and the Program
+ * is shared.
+ *
+ * A job's output and errors are kept in buffers of its own and written
+ * in the order of the jobs file, so the output does not depend on the
+ * number of threads. Workers stay at most MAX_PENDING jobs ahead of the
+ * job being written. Throughput and job latencies are reported on
+ * standard error at the end.
+ */
+class BatchRunner {
+    public:
+        /**
+         * @param int threads - 0 for one per CPU.
+         */
+        BatchRunner(std::string path, int threads);
+        ~BatchRunner();
+
+        std::string path;
+        int threads;
+
+        /**
+         * @return int - exit status, failure if a job failed.
+         */
+        int run();
+
+        static const size_t MAX_PENDING = 256;
+
+        /**
+         * Reads the script paths of a jobs file, blank lines are skipped.
+         *
+         * @return bool - false with `error` set if it can not be read.
+         */
+        static bool read_jobs(const std::string& path, std::vector<std::string>& jobs, std::string& error);
+
+        /**
+         * @return Program* - the script at `path`, parsed. Throws
+         * std::runtime_error.
+         */
+        static Program* parse_file(const std::string& path);
+
+        /**
+         * Writes the summary line to standard error.
+         *
+         * @param std::string workers - e.g. "4 threads".
+         */
+        static void report(std::vector<long> latencies, size_t failed, std::string workers, double seconds);
+
+    private:
+        struct Job {
+            std::string path;
+            Output* output;
+            Output* error;
+            bool done;
+            bool failed;
+            long nanoseconds;
+        };
+
+        struct Queue {
+            std::mutex lock;
+            std::deque<size_t> jobs;
+        };
+
+        struct CachedProgram {
+            std::once_flag once;
+            Program* program;
+            std::string error;
+        };
+
+        enum Take { Taken, Blocked, Empty };
+
+        std::vector<Job> jobs;
+        std::vector<Queue*> queues;
+
+        std::mutex programs_lock;
+        std::map<std::string, CachedProgram*> programs;
+
+        /* guards `done` of the jobs, `emitted` only changes with it held */
+        std::mutex lock;
+        std::condition_variable finished;
+        std::condition_variable progress;
+
+        /* jobs written so far */
+        std::atomic<size_t> emitted;
+
+        void work(size_t worker);
+        Take take(size_t worker, size_t limit, size_t& job);
+        void run_job(Job& job);
+
+        /**
+         * @return Program* - parsed on first use. Throws std::runtime_error.
+         */
+        Program* compile(const std::string& path);
+
+        void emit(Job& job);
+};
+#endif
@@ -0,0 +1,20 @@
+#ifndef CLIENT_H
+#define CLIENT_H
+#include <string>
+#include <vector>
+
+
+/**
+ * `wscript.out --client <socket> [options] <script>.vbs ...`: hands the
+ * command line, working directory and standard descriptors to a server
+ * (see Server) and exits with the script's status.
+ */
+class Client {
+    public:
+        /**
+         * @return int - the exit status of the script, EXIT_FAILURE if the
+         * server can not be reached.
+         */
+        static int run(std::string path, std::vector<std::string> args);
+};
+#endif
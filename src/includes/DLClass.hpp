@@ -15,6 +15,12 @@ class DLClass {
         template <typename... Args>
             std::shared_ptr<T> make_obj(Args... args);
 
+        /**
+         * Opens the module and resolves its symbols ahead of the
+         * first make_obj.
+         */
+        bool open();
+
     private:
         struct shared_obj {
             typename T::create_t *create = NULL;
@@ -51,6 +51,14 @@ bool DLClass<T>::shared_obj::open_module(std::string module) {
     return true;
 }
 
+template <class T>
+bool DLClass<T>::open() {
+    if(shared->create && shared->destroy)
+        return true;
+
+    return shared->open_module(module);
+}
+
 template <class T> template< typename... Args>
 std::shared_ptr<T> DLClass<T>::make_obj(Args... args) {
     if(!shared->create || !shared->destroy) {
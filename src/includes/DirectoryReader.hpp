@@ -0,0 +1,75 @@
+#ifndef DIRECTORYREADER_H
+#define DIRECTORYREADER_H
+#include <string>
+#include <stddef.h>
+
+#ifndef __linux__
+#include <dirent.h>
+#endif
+
+
+struct DirectoryEntry {
+    std::string name;
+
+    /**
+     * Symbolic links are classified by what they point to and also
+     * flagged as `link`, so walkers can avoid following them.
+     */
+    bool directory;
+    bool link;
+};
+
+/**
+ * Streams the entries of one directory, without `.` and `..`.
+ *
+ * On Linux entries are fetched with `getdents64` into a buffer large
+ * enough for a few thousand names per system call. Only entries whose
+ * type the file system does not report (or symbolic links) cost an
+ * extra `fstatat`.
+ */
+class DirectoryReader {
+    public:
+        DirectoryReader(const std::string& path);
+        ~DirectoryReader();
+
+        std::string path;
+
+        /**
+         * errno of opening the directory, 0 if it is open.
+         */
+        int error;
+
+        /**
+         * @return bool - false after the last entry.
+         */
+        bool next(DirectoryEntry& entry);
+
+        static const size_t BUFFER_SIZE = 256 * 1024;
+
+    private:
+        int fd;
+
+#ifdef __linux__
+        char* buffer;
+
+        /**
+         * Unread entries are buffer[offset, length).
+         */
+        size_t offset;
+        size_t length;
+#else
+        DIR* dir;
+#endif
+
+        /**
+         * Sets `directory` and `link` from the type reported with the
+         * entry, falling back to `resolve`.
+         */
+        void classify(DirectoryEntry& entry, unsigned char type);
+
+        /**
+         * Classifies a symbolic link or an entry of unknown type.
+         */
+        void resolve(DirectoryEntry& entry, bool link);
+};
+#endif
@@ -0,0 +1,80 @@
+#ifndef DIRECTORYWALKER_H
+#define DIRECTORYWALKER_H
+#include "DirectoryReader.hpp"
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+/**
+ * Recursive directory traversal in depth-first order: every entry is
+ * followed by the contents of the directory it names. Symbolic links
+ * to directories are returned but not followed.
+ *
+ * With `threads` > 0 worker threads list directories ahead of the
+ * reader, at most MAX_BUFFERED entries that have not been returned yet.
+ * The order does not depend on the number of threads: a directory the
+ * reader reaches before any worker did is listed by the reader itself.
+ */
+class DirectoryWalker {
+    public:
+        DirectoryWalker(const std::string& root, int threads);
+        ~DirectoryWalker();
+
+        /**
+         * @param std::string& directory - set to the directory containing `entry`.
+         *
+         * @return bool - false after the last entry.
+         */
+        bool next(std::string& directory, DirectoryEntry& entry);
+
+        static const size_t MAX_BUFFERED = 64 * 1024;
+
+    private:
+        struct Listing {
+            enum State { Queued, Running, Done };
+
+            std::string path;
+            State state;
+            std::vector<DirectoryEntry> entries;
+
+            /**
+             * One per entry that is descended into, in the same order.
+             */
+            std::vector<Listing*> children;
+        };
+
+        struct Frame {
+            Listing* listing;
+            bool ready;
+            size_t index;
+            size_t child;
+        };
+
+        std::vector<Frame> stack;
+
+        std::mutex lock;
+        std::condition_variable work;
+        std::condition_variable listed;
+
+        /**
+         * Listings not picked up yet, workers take from the back so the
+         * walk runs ahead of the reader roughly depth first.
+         */
+        std::deque<Listing*> queue;
+        size_t buffered;
+        bool stopping;
+
+        std::vector<std::thread> workers;
+
+        void list(Listing* listing);
+        void wait(Listing* listing);
+        void run();
+        void stop();
+
+        static void release(Listing* listing);
+};
+#endif
@@ -0,0 +1,139 @@
+#ifndef EXECUTION_CONTEXT_H
+#define EXECUTION_CONTEXT_H
+#include "Scope.hpp"
+#include "Output.hpp"
+#include <vector>
+#include <map>
+#include <set>
+
+
+class AST_Object_TextStream;
+class AST_ClassDefinition;
+
+/**
+ * Everything one run of a script changes: its global variables,
+ * functions and classes, the builtins, the locals of its functions and
+ * its standard streams.
+ *
+ * The scopes the parser creates only describe where a name lives, a
+ * run keeps the values in copies of them (see `frame`), so a Program
+ * can be run by several Interpreters at once, each with its own context.
+ * A context is used by one thread at a time.
+ */
+class ExecutionContext {
+    public:
+        /**
+         * What a task submitted to a TaskPool starts from: the globals,
+         * functions and classes of the context that submitted it, as they
+         * were at that moment.
+         */
+        struct Snapshot {
+            std::map<std::string, anything> variables;
+            std::map<std::string, AST_ClassDefinition*> classes;
+
+            /* of the global scope, then of every frame */
+            std::vector<std::vector<AST_FunctionDefinition*> > functions;
+
+            /* the copies made for the task, by original */
+            std::map<AST*, AST*> copies;
+
+            /* arrays shared with the task, borrowed by both contexts */
+            std::set<AST*> borrowed;
+        };
+
+        /**
+         * @param Output* output - where print, WScript.Echo and StdOut
+         * write, not owned by the context.
+         */
+        ExecutionContext(Output* output);
+
+        /**
+         * @param Output* error - where StdErr writes, not owned either.
+         */
+        ExecutionContext(Output* output, Output* error);
+        ~ExecutionContext();
+
+        /**
+         * Forgets everything a run left behind, so the context can run a
+         * script again as if it was new. The builtins and the scopes are
+         * kept, not allocated again (see wscript_embed.h).
+         *
+         * @param Output* error - nullptr to write StdErr to the standard
+         * error again.
+         */
+        void reset(Output* output, Output* error);
+
+        /**
+         * Scalars are copied, the rest goes through `share`. Throws
+         * std::runtime_error if a global can not be shared.
+         */
+        Snapshot* snapshot();
+
+        /**
+         * Makes `value` safe to hand to the task of `snapshot`, which
+         * runs on another thread.
+         *
+         * Arrays of scalars are shared and become borrowed here and in
+         * the task (see `borrowed`). Dictionaries, class instances, the
+         * arrays that hold them and the arrays inside them are copied,
+         * a value that was shared by several variables is copied once.
+         * Objects without state of their own are shared.
+         *
+         * @return bool - false for objects that can not be copied or
+         * shared: text streams and extension objects.
+         */
+        bool share(anything& value, Snapshot& snapshot, bool nested = false);
+
+        /**
+         * Starts a fresh or reset context from `snapshot`.
+         */
+        void restore(const Snapshot& snapshot);
+
+        /**
+         * Arrays this context shares with a task or the context that
+         * submitted it. They are copied before they are changed (see
+         * Interpreter::writable), which copies them at most once.
+         */
+        std::set<AST*> borrowed;
+
+        /* the script's global scope, with the builtins */
+        Scope* globals;
+
+        Output* output;
+
+        /* nullptr until StdErr is used if none was given */
+        Output* error;
+
+        /**
+         * @param Scope* declared - the scope a node was parsed in,
+         * nullptr for the global scope.
+         *
+         * @return Scope* - this run's copy of it, created on first use.
+         */
+        Scope* frame(Scope* declared);
+
+        /**
+         * @param int fd - 0, 1 or 2.
+         *
+         * @return AST_Object_TextStream* - WScript.StdIn, StdOut or StdErr,
+         * created on first use.
+         */
+        AST_Object_TextStream* stream(int fd);
+
+        /**
+         * @return Output* - `error`, writing to the standard error if none
+         * was given.
+         */
+        Output* error_output();
+
+    private:
+        std::vector<Scope*> frames;
+
+        AST_Object_TextStream* streams[3];
+
+        bool owns_error;
+
+        void close_streams();
+        static void clear_scope(Scope* scope);
+};
+#endif
@@ -0,0 +1,77 @@
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+#include "typedefs.hpp"
+#include <vector>
+#include <stdint.h>
+
+
+/**
+ * Insertion ordered hash table with `anything` keys, used by
+ * Scripting.Dictionary.
+ *
+ * Entries are appended to `entries` and never move until the table is
+ * rebuilt or cleared, which bumps `modifications`. `slots` is an open
+ * addressing (linear probing) index into `entries`. Every entry caches
+ * the hash of its key.
+ *
+ * Strings, numbers and objects are different kinds of keys, numbers are
+ * compared by value so 1 and 1.0 are the same key.
+ * With `text_compare` strings are hashed and compared case-insensitively.
+ */
+class HashTable {
+    public:
+        HashTable();
+        ~HashTable();
+
+        struct Entry {
+            /* increases in insertion order, survives rebuilds */
+            uint64_t order;
+            uint64_t hash;
+            bool removed;
+            anything key;
+            anything value;
+        };
+
+        bool text_compare;
+
+        std::vector<Entry> entries;
+
+        /* indices into `entries` stay valid as long as this does not change */
+        uint64_t modifications;
+
+        /* `order` of the next entry */
+        uint64_t next_order;
+
+        /**
+         * @return size_t - index of the first entry with an `order` of at
+         * least `order`, `entries.size()` if there is none.
+         */
+        size_t position(uint64_t order);
+
+        size_t count();
+
+        anything* find(anything key);
+
+        void set(anything key, anything value);
+
+        bool remove(anything key);
+
+        void clear();
+
+        uint64_t hash(anything key);
+        bool equals(anything left, anything right);
+
+    private:
+        static const int32_t EMPTY = -1;
+        static const int32_t DELETED = -2;
+
+        std::vector<int32_t> slots;
+
+        size_t live;
+        size_t used_slots;
+
+        int32_t lookup(anything key, uint64_t hash, size_t* slot);
+
+        void rebuild(size_t capacity);
+};
+#endif
@@ -0,0 +1,34 @@
+#ifndef INLINE_CACHE_H
+#define INLINE_CACHE_H
+#include <atomic>
+
+
+class AST_BuiltinFunctionDefinition;
+
+/**
+ * Polymorphic inline cache of a member access call site.
+ *
+ * Maps the class of the object (its MethodTable) to the method found for
+ * that class.
+ * Remembers up to `SIZE` classes, call sites that see more than that are
+ * megamorphic and go through the regular lookup.
+ *
+ * Entries are only ever added, lookups and additions are lock free so a
+ * parsed script can be run from several threads at once.
+ */
+class InlineCache {
+    public:
+        static const int SIZE = 4;
+
+        InlineCache();
+
+        AST_BuiltinFunctionDefinition* find(const void* klass);
+
+        void add(const void* klass, AST_BuiltinFunctionDefinition* function);
+
+    private:
+        std::atomic<const void*> classes[SIZE];
+        std::atomic<AST_BuiltinFunctionDefinition*> functions[SIZE];
+        std::atomic<int> used;
+};
+#endif
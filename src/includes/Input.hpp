@@ -0,0 +1,56 @@
+#ifndef INPUT_H
+#define INPUT_H
+#include <string>
+#include <stddef.h>
+
+
+/**
+ * Buffered reader for text streams.
+ *
+ * Lines are cut out of a large read-ahead buffer that is reused for
+ * the whole stream, so reading a line costs one copy into the result.
+ */
+class Input {
+    public:
+        Input(int fd);
+        ~Input();
+
+        int fd;
+
+        static const size_t BUFFER_SIZE = 1024 * 1024;
+
+        /**
+         * Reads up to the next newline, which is not included
+         * (neither is a `\r` before it).
+         *
+         * @return bool - false if the stream was already at its end.
+         */
+        bool read_line(std::string& line);
+
+        /**
+         * Appends the rest of the stream to `contents`. Regular files are
+         * mapped and copied into `contents` in one go.
+         */
+        void read_all(std::string& contents);
+
+        bool at_end();
+
+    private:
+        char* buffer;
+
+        /**
+         * Unread bytes are buffer[start, end).
+         */
+        size_t start;
+        size_t end;
+
+        bool eof;
+
+        /**
+         * Moves the unread bytes to the front and reads more after them.
+         *
+         * @return bool - false if nothing could be read.
+         */
+        bool fill();
+};
+#endif
@@ -2,16 +2,32 @@
 #define INTERPRETER_H
 #include "NodeVisitor.hpp"
 #include "Parser.hpp"
+#include "Program.hpp"
+#include "ExecutionContext.hpp"
 
 
-extern Scope* global_scope;
+class AST_Object_Dictionary;
+class AST_ClassInstance;
 
 class Interpreter: public NodeVisitor {
     public:
+        /**
+         * Parses the script itself in `interpret`, in a context of its own
+         * writing to the standard output.
+         */
         Interpreter(Parser* parser);
+
+        /**
+         * Runs `program` in `context`, neither is owned by the interpreter.
+         * Interpreters that share a program can run on different threads
+         * as long as their contexts differ.
+         */
+        Interpreter(Program* program, ExecutionContext* context);
         ~Interpreter();
 
         Parser* parser;
+        Program* program;
+        ExecutionContext* context;
 
         void error(std::string message);
 
@@ -24,9 +40,36 @@ class Interpreter: public NodeVisitor {
         anything visit_AST_functionCall(AST_FunctionCall* node);
         anything visit_AST_functionDefinition(AST_FunctionDefinition* node);
         anything visit_AST_Return(AST_Return* node);
-        anything visit_AST_AttributeAccess(AST_AttributeAccess* node);
+        anything visit_AST_MemberAccess(AST_MemberAccess* node);
         anything visit_AST_ArrayAccess(AST_ArrayAccess* node);
         anything visit_AST_Array(AST_Array* node);
+        anything visit_AST_ArrayAssign(AST_ArrayAssign* node);
+        anything visit_AST_Value(AST_Value* node);
+        anything visit_AST_New(AST_New* node);
+        anything visit_AST_Me(AST_Me* node);
+        anything visit_AST_SlotAccess(AST_SlotAccess* node);
+        anything visit_AST_SlotAssign(AST_SlotAssign* node);
+        anything visit_AST_WithObject(AST_WithObject* node);
+
+        anything dictionary_member(AST_Object_Dictionary* dict, AST_MemberAccess* node);
+        anything scope_member(Scope* scope, AST_MemberAccess* node);
+        anything index_value(anything value, std::vector<AST*> args, std::string name);
+        void assign_element(anything target, std::vector<AST*> args, anything value, std::string name);
+        anything stored(anything value);
+        Scope* variable_scope(Scope* scope, const std::string& name);
+        AST_Array* writable(Scope* scope, const std::string& name, AST_Array* array);
+        anything instance_member(AST_ClassInstance* instance, AST_MemberAccess* node);
+
+        /* classes */
+
+        anything invoke(AST_FunctionDefinition* definition, AST_ClassInstance* self, std::vector<AST*> args);
+        AST_ClassInstance* current_instance();
+
+        /* the objects whose methods are running, innermost last */
+        std::vector<AST_ClassInstance*> me_stack;
+
+        /* targets of the With blocks being run, by nesting level */
+        std::vector<anything> with_slots;
 
         AST_Object* visit_AST_Object(AST_Object* node);
         AST_Empty* visit_AST_Empty(AST_Empty* node);
@@ -35,8 +78,12 @@ class Interpreter: public NodeVisitor {
         int visit_AST_Compound(AST_Compound* node);
         int visit_AST_NoOp(AST_NoOp* node);
         int visit_AST_VarDecl(AST_VarDecl* node);
+        int visit_AST_ReDim(AST_ReDim* node);
         int visit_AST_Abstract_Condition(AST_Abstract_Condition* node);
         int visit_AST_DoWhile(AST_DoWhile* node);
+        int visit_AST_ForEach(AST_ForEach* node);
+        int visit_AST_ClassDefinition(AST_ClassDefinition* node);
+        int visit_AST_With(AST_With* node);
 
         float visit_AST_Float(AST_Float* node);
 
@@ -61,6 +108,13 @@ class Interpreter: public NodeVisitor {
         anything unary_operation(TokenType op, float right);
         anything unary_operation(TokenType op, std::string right);
 
+        /* array helpers */
+
+        AST_Array* new_array(std::map<std::string, TokenType>& types, std::string varname);
+
+        std::vector<int> array_dimensions(std::vector<AST*> bounds);
+        int array_offset(AST_Array* array, std::vector<AST*> args);
+
         anything interpret();
 };
 #endif
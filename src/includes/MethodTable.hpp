@@ -0,0 +1,33 @@
+#ifndef METHOD_TABLE_H
+#define METHOD_TABLE_H
+#include <string>
+#include <map>
+#include "intern.hpp"
+
+
+class AST_BuiltinMethodDefinition;
+
+/**
+ * Name -> native method lookup shared by all instances of a builtin
+ * object class. Tables are created once and never modified afterwards,
+ * so they can be read from any thread.
+ */
+class MethodTable {
+    public:
+        MethodTable(std::string class_name);
+        ~MethodTable();
+
+        std::string class_name;
+
+        void define(AST_BuiltinMethodDefinition* method);
+
+        /**
+         * @return AST_BuiltinMethodDefinition* - nullptr if the class
+         * has no such method.
+         */
+        AST_BuiltinMethodDefinition* get(Atom name);
+
+    private:
+        std::map<Atom, AST_BuiltinMethodDefinition*> methods;
+};
+#endif
@@ -0,0 +1,80 @@
+#ifndef MODULE_CACHE_H
+#define MODULE_CACHE_H
+#include <string>
+#include <map>
+#include <mutex>
+#include <future>
+#include <atomic>
+#include <stdint.h>
+#include "NativeModule.hpp"
+#include "DLClass.hpp"
+#include "AST/AST_ObjectCustom.hpp"
+
+
+/**
+ * Process-wide cache of the extension libraries loaded by CreateObject.
+ *
+ * Every library is opened and its symbols are resolved once, later
+ * lookups of the same path share the result. Lookups may come from any
+ * thread, a lookup of a library that is still being loaded waits for it.
+ */
+class ModuleCache {
+    public:
+        struct Module {
+            /**
+             * Set for libraries implementing the native extension ABI.
+             */
+            NativeModule* native;
+
+            /**
+             * Set for libraries that only export create/destroy.
+             */
+            DLClass<AST_ObjectCustom>* legacy;
+
+            /**
+             * Why the library could not be loaded, empty on success.
+             */
+            std::string error;
+        };
+
+        struct Stats {
+            std::atomic<uint64_t> loads;
+            std::atomic<uint64_t> hits;
+            std::atomic<uint64_t> prefetches;
+
+            /**
+             * Total time spent in dlopen and symbol lookup.
+             */
+            std::atomic<uint64_t> load_nanoseconds;
+        };
+
+        static ModuleCache* instance();
+
+        /**
+         * @return Module* - never nullptr, check `error`.
+         */
+        Module* get(std::string path);
+
+        /**
+         * Starts loading `path` on a background thread unless it is
+         * already loaded or loading.
+         */
+        void prefetch(std::string path);
+
+        Stats stats;
+
+    private:
+        ModuleCache();
+
+        std::mutex lock;
+        std::map<std::string, std::shared_future<Module*>> modules;
+
+        /**
+         * @return bool - true if the caller has to load `path` and
+         * fulfill `promise`.
+         */
+        bool reserve(std::string path, std::shared_future<Module*>& future, std::promise<Module*>*& promise);
+
+        Module* load(std::string path);
+};
+#endif
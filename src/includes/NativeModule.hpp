@@ -0,0 +1,50 @@
+#ifndef NATIVE_MODULE_H
+#define NATIVE_MODULE_H
+#include <string>
+#include "wscript_extension.h"
+#include "MethodTable.hpp"
+
+
+/**
+ * A shared library implementing the native extension ABI
+ * (see wscript_extension.h).
+ *
+ * Modules are owned by ModuleCache and stay loaded for the lifetime of
+ * the process, objects created from them may outlive the script
+ * statement that loaded them.
+ */
+class NativeModule {
+    public:
+        NativeModule(std::string path, void* handle, const ws_module* module);
+        ~NativeModule();
+
+        std::string path;
+
+        void* handle;
+
+        const ws_module* module;
+
+        /**
+         * One AST_NativeMethod per entry of the module's method table.
+         */
+        MethodTable* methods;
+
+        /**
+         * Reads the module description of an opened library and checks
+         * its ABI version.
+         *
+         * @param std::string& error - set when the library cannot be used.
+         *
+         * @return NativeModule* - nullptr with an empty `error` for
+         * libraries that only implement the old create/destroy interface.
+         */
+        static NativeModule* open(std::string path, void* handle, std::string& error);
+
+        /**
+         * Same as `open` for an entry point that has already been
+         * resolved, `handle` is nullptr for extensions linked into
+         * the interpreter.
+         */
+        static NativeModule* from_entry(std::string path, void* handle, ws_module_entry_t* entry, std::string& error);
+};
+#endif
@@ -16,13 +16,24 @@
 #include "AST/AST_UserDefinedFunctionCall.hpp"
 #include "AST/AST_FunctionDefinition.hpp"
 #include "AST/AST_DoWhile.hpp"
+#include "AST/AST_ForEach.hpp"
 #include "AST/AST_Return.hpp"
-#include "AST/AST_AttributeAccess.hpp"
+#include "AST/AST_MemberAccess.hpp"
 #include "AST/AST_ArrayAccess.hpp"
 #include "AST/AST_StringAccess.hpp"
 #include "AST/AST_Object.hpp"
 #include "AST/AST_Empty.hpp"
 #include "AST/AST_Array.hpp"
+#include "AST/AST_ReDim.hpp"
+#include "AST/AST_ArrayAssign.hpp"
+#include "AST/AST_Value.hpp"
+#include "AST/AST_ClassDefinition.hpp"
+#include "AST/AST_New.hpp"
+#include "AST/AST_Me.hpp"
+#include "AST/AST_SlotAccess.hpp"
+#include "AST/AST_SlotAssign.hpp"
+#include "AST/AST_With.hpp"
+#include "AST/AST_WithObject.hpp"
 #include <string>
 #include "typedefs.hpp"
 
@@ -41,9 +52,16 @@ class NodeVisitor {
         virtual anything visit_AST_functionCall(AST_FunctionCall* node) = 0;
         virtual anything visit_AST_functionDefinition(AST_FunctionDefinition* node) = 0;
         virtual anything visit_AST_Return(AST_Return* node) = 0;
-        virtual anything visit_AST_AttributeAccess(AST_AttributeAccess* node) = 0;
+        virtual anything visit_AST_MemberAccess(AST_MemberAccess* node) = 0;
         virtual anything visit_AST_ArrayAccess(AST_ArrayAccess* node) = 0;
         virtual anything visit_AST_Array(AST_Array* node) = 0;
+        virtual anything visit_AST_ArrayAssign(AST_ArrayAssign* node) = 0;
+        virtual anything visit_AST_Value(AST_Value* node) = 0;
+        virtual anything visit_AST_New(AST_New* node) = 0;
+        virtual anything visit_AST_Me(AST_Me* node) = 0;
+        virtual anything visit_AST_SlotAccess(AST_SlotAccess* node) = 0;
+        virtual anything visit_AST_SlotAssign(AST_SlotAssign* node) = 0;
+        virtual anything visit_AST_WithObject(AST_WithObject* node) = 0;
 
         virtual AST_Empty* visit_AST_Empty(AST_Empty* node) = 0;
         virtual AST_Object* visit_AST_Object(AST_Object* node) = 0;
@@ -54,8 +72,12 @@ class NodeVisitor {
         virtual int visit_AST_Compound(AST_Compound* node) = 0;
         virtual int visit_AST_NoOp(AST_NoOp* node) = 0;
         virtual int visit_AST_VarDecl(AST_VarDecl* node) = 0;
+        virtual int visit_AST_ReDim(AST_ReDim* node) = 0;
         virtual int visit_AST_Abstract_Condition(AST_Abstract_Condition* node) = 0;
         virtual int visit_AST_DoWhile(AST_DoWhile* node) = 0;
+        virtual int visit_AST_ForEach(AST_ForEach* node) = 0;
+        virtual int visit_AST_ClassDefinition(AST_ClassDefinition* node) = 0;
+        virtual int visit_AST_With(AST_With* node) = 0;
 
         virtual std::string visit_AST_Str(AST_Str* node) = 0;
 
@@ -0,0 +1,46 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+#include "Output.hpp"
+#include <string>
+#include <vector>
+
+
+/**
+ * The command line of a script run. The server parses the command lines
+ * it receives from clients the same way.
+ */
+struct Options {
+    std::string filename;
+
+    /* -n and -p, see RecordLoop */
+    bool records;
+    bool print;
+    std::vector<std::string> inputs;
+
+    /* --flush= */
+    bool has_policy;
+    Output::FlushPolicy policy;
+
+    /* --serve <socket> and --client <socket> */
+    std::string serve;
+    std::string client;
+
+    /* --batch <jobs file>, -j <threads> and --prefork <processes>, see
+       BatchRunner and PreforkSupervisor */
+    std::string batch;
+    int threads;
+    int processes;
+
+    /**
+     * Everything but `--client <socket>`, what a client sends to the server.
+     */
+    std::vector<std::string> forwarded;
+};
+
+/**
+ * @param std::vector<std::string> args - without the program name.
+ *
+ * @return bool - false with `error` set for invalid arguments.
+ */
+bool parse_options(const std::vector<std::string>& args, Options& options, std::string& error);
+#endif
@@ -0,0 +1,111 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+
+/**
+ * Buffered writer for the interpreter's output.
+ *
+ * Output is collected in fixed size chunks and handed to the kernel
+ * with a single `writev` per flush. When it is flushed depends on the
+ * policy:
+ *
+ * - Line: after every line, the default when writing to a terminal.
+ * - Full: when `FULL_CHUNKS` chunks are filled, the default otherwise.
+ * - Exit: only when the process exits (or `flush` is called).
+ *
+ * An Output with `fd` -1 keeps everything it is given until it is
+ * assigned a file (see BatchRunner), it has to use the Exit policy.
+ * One with a `sink` hands what is flushed to it instead of a file, the
+ * embedding API uses this for its output callbacks.
+ */
+class Output {
+    public:
+        enum FlushPolicy { Line, Full, Exit };
+
+        typedef void Sink(void* data, const char* buffer, size_t size);
+
+        Output(int fd, FlushPolicy policy);
+
+        /**
+         * @param Sink* sink - called with every flushed chunk.
+         */
+        Output(Sink* sink, void* data, FlushPolicy policy);
+        ~Output();
+
+        int fd;
+
+        FlushPolicy policy;
+
+        Sink* sink;
+        void* sink_data;
+
+        /**
+         * @return Output* - the script's standard output.
+         */
+        static Output* standard();
+
+        /**
+         * Flushes every Output that has not been destroyed, this happens
+         * on its own when the process exits or terminates.
+         */
+        static void flush_all();
+
+        /**
+         * @return FlushPolicy - Line for terminals, Full otherwise.
+         */
+        static FlushPolicy default_policy(int fd);
+
+        /**
+         * @param std::string name - "line", "full" or "exit".
+         * @param FlushPolicy& policy - set if `name` is valid.
+         *
+         * @return bool - false for unknown names.
+         */
+        static bool parse_policy(std::string name, FlushPolicy& policy);
+
+        void write(const char* data, size_t size);
+        void write(const std::string& value);
+        void put(char c);
+
+        /**
+         * Ends the current line, flushing it under the Line policy.
+         */
+        void newline();
+
+        /**
+         * Space for `size` (at most CHUNK_SIZE) contiguous bytes, to be
+         * committed with `commit` after formatting into it.
+         *
+         * @return char*
+         */
+        char* reserve(size_t size);
+        void commit(size_t size);
+
+        void flush();
+
+        /**
+         * @return size_t - bytes written but not flushed yet.
+         */
+        size_t pending();
+
+        static const size_t CHUNK_SIZE = 64 * 1024;
+        static const size_t FULL_CHUNKS = 16;
+
+    private:
+        std::vector<char*> chunks;
+
+        /**
+         * Bytes used in each chunk before `current`.
+         */
+        std::vector<size_t> lengths;
+
+        /**
+         * Index of the chunk being filled and the bytes used in it.
+         */
+        size_t current;
+        size_t used;
+};
+#endif
@@ -8,8 +8,13 @@
 #include "AST/AST_FunctionCall.hpp"
 #include "AST/AST_FunctionDefinition.hpp"
 #include "AST/AST_DoWhile.hpp"
-#include "AST/AST_AttributeAccess.hpp"
+#include "AST/AST_ForEach.hpp"
+#include "AST/AST_MemberAccess.hpp"
 #include "AST/AST_Object.hpp"
+#include "AST/AST_UserDefinedFunctionCall.hpp"
+#include "AST/AST_ClassDefinition.hpp"
+#include "AST/AST_With.hpp"
+#include <map>
 
 
 class Parser {
@@ -20,6 +25,19 @@ class Parser {
         Lexer* lexer;
         Token* current_token;
 
+        /* the class being parsed and the locals of the current method */
+        AST_ClassDefinition* current_class;
+        std::vector<std::string> locals;
+
+        /* number of With blocks around the current statement */
+        int with_depth;
+
+        /* the script's global scope, only describes it, see ExecutionContext */
+        Scope* scope;
+
+        /* the scopes of all functions and methods parsed so far */
+        std::vector<Scope*> scopes;
+
         void eat(TokenType token_type);
         void error(std::string message);
 
@@ -31,16 +49,36 @@ class Parser {
         AST* assignment_statement(AST_Var* left, Scope* scope);
         AST* if_statement(Scope* scope);
         AST* variable_declaration(Scope* scope);
+        AST* redim_statement(Scope* scope);
+        AST* array_assignment(AST_UserDefinedFunctionCall* left, Scope* scope);
         AST* empty(Scope* scope);
         AST* id_action(Scope* scope);
         AST_Var* variable(Scope* scope);
         AST_DoWhile* do_while(Scope* scope);
+        AST_ForEach* for_each(Scope* scope);
+        AST_With* with_statement(Scope* scope);
+        AST* with_member(Scope* scope);
         AST_Object* object(Scope* scope);
-        AST_AttributeAccess* attribute_access(AST* left, Scope* scope);
+        AST* attribute_access(AST* left, Scope* scope);
+        AST_MemberAccess* member_access(AST* object, Scope* scope);
         AST_FunctionCall* function_call(Scope* scope);
         AST_FunctionDefinition* function_definition(Scope* scope);
+        AST_FunctionDefinition* function_body(Scope* scope, std::string name, std::vector<Token*> args, TokenType end);
+        AST_FunctionDefinition* property_definition(Scope* scope, bool& setter);
+        AST_ClassDefinition* class_definition(Scope* scope);
+
+        std::vector<Token*> parameter_list();
+
+        void class_fields(AST_ClassDefinition* definition);
+        int field_slot(std::string name);
+        AST* field_access(int slot, AST_UserDefinedFunctionCall* call, Scope* scope);
 
         std::vector<AST*> statement_list(Scope* scope);
+        std::vector<AST*> array_dimensions(Scope* scope);
+
+        void declaration_list(Scope* scope, std::vector<Token*>& tokens, std::map<std::string, std::vector<AST*> >& arrays, std::map<std::string, TokenType>& types);
+
+        TokenType type_name();
 
         AST* parse();
 };
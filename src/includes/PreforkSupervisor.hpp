@@ -0,0 +1,117 @@
+#ifndef PREFORKSUPERVISOR_H
+#define PREFORKSUPERVISOR_H
+#include "Program.hpp"
+#include <sys/types.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <atomic>
+
+
+/**
+ * `wscript.out --batch jobs.txt --prefork N`: runs the jobs of a jobs
+ * file (see BatchRunner) in N worker processes, so a job that crashes
+ * only takes its own worker down.
+ *
+ * Every script is parsed once, by the supervisor, before the workers
+ * are forked. The workers share the Programs copy-on-write and start
+ * running jobs right away. Jobs are numbered up front and handed out
+ * through a queue in shared memory: a worker claims the next job with
+ * an atomic increment, without locks or a round trip through the
+ * supervisor.
+ *
+ * Workers send each job's output and errors back through a pipe, the
+ * supervisor writes them in the order of the jobs file. A worker that
+ * dies is replaced, the job it was running fails.
+ */
+class PreforkSupervisor {
+    public:
+        PreforkSupervisor(std::string path, int processes);
+        ~PreforkSupervisor();
+
+        std::string path;
+        int processes;
+
+        /**
+         * @return int - exit status, failure if a job failed.
+         */
+        int run();
+
+        static const int MAX_PROCESSES = 256;
+
+        /**
+         * How far workers may claim jobs ahead of the job being written.
+         */
+        static const uint32_t MAX_PENDING = 256;
+
+    private:
+        /**
+         * Lives in memory shared with the workers.
+         */
+        struct SharedQueue {
+            uint32_t count;
+
+            /* the next job to be claimed */
+            std::atomic<uint32_t> next;
+
+            /* jobs written by the supervisor, workers wait on it */
+            std::atomic<uint32_t> emitted;
+
+            /* the job each worker is running, -1 if none */
+            std::atomic<int64_t> running[MAX_PROCESSES];
+        };
+
+        /**
+         * Sent ahead of a job's output and errors.
+         */
+        struct Frame {
+            uint32_t job;
+            uint32_t failed;
+            int64_t nanoseconds;
+            uint64_t output;
+            uint64_t error;
+        };
+
+        struct Worker {
+            pid_t pid;
+
+            /* read end of the worker's pipe, -1 once it exited */
+            int fd;
+
+            std::string received;
+        };
+
+        struct Result {
+            bool done;
+            bool failed;
+            long nanoseconds;
+            std::string output;
+            std::string error;
+        };
+
+        std::vector<std::string> jobs;
+
+        /* parsed scripts, or why they could not be parsed */
+        std::map<std::string, Program*> programs;
+        std::map<std::string, std::string> errors;
+
+        SharedQueue* queue;
+        std::vector<Worker> workers;
+        std::vector<Result> results;
+
+        bool spawn(int slot);
+
+        /**
+         * The worker process, does not return.
+         */
+        void work(int slot, int fd);
+        void run_job(uint32_t job, int fd);
+
+        /**
+         * @return bool - false once the worker's pipe is closed.
+         */
+        bool receive(Worker& worker);
+        void reap(int slot);
+};
+#endif
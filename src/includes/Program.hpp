@@ -0,0 +1,25 @@
+#ifndef PROGRAM_H
+#define PROGRAM_H
+#include "Parser.hpp"
+#include <string>
+
+
+/**
+ * A parsed script.
+ *
+ * Running a program does not change it, the state of a run lives in its
+ * ExecutionContext. One program can be shared by any number of
+ * Interpreters, also on different threads.
+ */
+class Program {
+    public:
+        /**
+         * Parses `source`, throws std::runtime_error on syntax errors.
+         */
+        Program(std::string source);
+        ~Program();
+
+        Parser* parser;
+        AST* tree;
+};
+#endif
@@ -0,0 +1,50 @@
+#ifndef RECORDLOOP_H
+#define RECORDLOOP_H
+#include "Interpreter.hpp"
+#include "Input.hpp"
+#include "AST/AST_Compound.hpp"
+#include <string>
+#include <vector>
+
+
+/**
+ * Runs a script once per input line, like `awk` or `perl -n`
+ * (`wscript.out -n script.vbs [files...]`).
+ *
+ * The script is parsed once. Its top level `Dim`s, functions and
+ * classes are run before the first line, so variables keep their values
+ * from one line to the next, and the remaining top level statements are
+ * run for every line with `Line` and `LineNumber` set. `Function
+ * OnBegin()` and `Function OnEnd()` are called before the first and
+ * after the last line when the script defines them.
+ *
+ * With `print` (`-p`) `Line` is written to the output after every line,
+ * so the script can change it.
+ */
+class RecordLoop {
+    public:
+        RecordLoop(Interpreter* interpreter, bool print);
+        ~RecordLoop();
+
+        Interpreter* interpreter;
+        bool print;
+
+        /**
+         * @param AST* tree - the parsed script.
+         * @param std::vector<std::string> inputs - files to read in order,
+         * standard input if there are none ("-" reads it as well).
+         */
+        void run(AST* tree, std::vector<std::string> inputs);
+
+    private:
+        /**
+         * The top level statements run for every line.
+         */
+        AST_Compound* body;
+
+        int line_number;
+
+        void read(Input* input);
+        void call_hook(std::string name);
+};
+#endif
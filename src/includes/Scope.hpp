@@ -10,6 +10,8 @@
 #include "AST/AST_Return.hpp"
 
 
+class AST_ClassDefinition;
+
 class Scope {
     public:
         Scope(std::string name);
@@ -19,9 +21,16 @@ class Scope {
 
         std::string name;
 
+        /**
+         * Where a run keeps its own copy of a scope the parser created,
+         * 0 for the script's global scope (see ExecutionContext::frame).
+         */
+        size_t slot;
+
         void set_variable(std::string key, anything);
         void define_function(AST_FunctionDefinition* definition);
         void define_builtin_function(AST_BuiltinFunctionDefinition* udfc);
+        void define_class(AST_ClassDefinition* definition);
         void free_var(std::string key);
 
         anything get_variable(std::string key);
@@ -30,9 +39,11 @@ class Scope {
 
         AST_FunctionDefinition* get_function_definition(std::string name);
         AST_BuiltinFunctionDefinition* get_builtin_function(std::string name);
+        AST_ClassDefinition* get_class(std::string name);
 
         std::map<std::string, anything> variables;
         std::vector<AST_FunctionDefinition*> function_definitions;
         std::vector<AST_BuiltinFunctionDefinition*> builtin_functions;
+        std::map<std::string, AST_ClassDefinition*> classes;
 };
 #endif
@@ -0,0 +1,63 @@
+#ifndef SERVER_H
+#define SERVER_H
+#include "Interpreter.hpp"
+#include "ServerProtocol.hpp"
+#include "Options.hpp"
+#include <sys/types.h>
+#include <string>
+#include <map>
+
+
+/**
+ * `wscript.out --serve <socket>`: runs the scripts clients submit
+ * (see Client) in a process that stays warm.
+ *
+ * Parsed scripts are kept by path and reused until the file's size or
+ * modification time changes, extension modules stay loaded in the
+ * ModuleCache. Every run gets an ExecutionContext of its own, so it
+ * starts from empty global and function scopes.
+ *
+ * Scripts run one at a time, they share the process' standard
+ * descriptors, which are switched to the client's for the duration of
+ * a run.
+ */
+class Server {
+    public:
+        Server(std::string path);
+        ~Server();
+
+        std::string path;
+
+        /**
+         * @return int - exit status, only returns if the socket can not be
+         * set up.
+         */
+        int serve();
+
+    private:
+        struct CachedProgram {
+            Program* program;
+            time_t mtime;
+            long mtime_nanoseconds;
+            off_t size;
+        };
+
+        std::map<std::string, CachedProgram*> programs;
+
+        /* the server's own working directory and standard descriptors */
+        int cwd;
+        int saved_fds[3];
+
+        /**
+         * @return Program* - the cached program for `filename` if it is
+         * up to date, parsed again otherwise. Throws std::runtime_error.
+         */
+        Program* compile(const std::string& filename);
+
+        /**
+         * @return int - the exit status for the client.
+         */
+        int handle(ServerRequest& request);
+        int run(Options& options);
+};
+#endif
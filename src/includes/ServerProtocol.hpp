@@ -0,0 +1,31 @@
+#ifndef SERVERPROTOCOL_H
+#define SERVERPROTOCOL_H
+#include <string>
+#include <vector>
+
+
+/**
+ * A script run submitted to `wscript.out --serve`.
+ *
+ * The client's stdin, stdout and stderr travel along as file
+ * descriptors (SCM_RIGHTS), so the script reads and writes them
+ * directly and nothing has to be relayed through the socket. The server
+ * answers with the exit status once the script's output is flushed.
+ */
+struct ServerRequest {
+    std::string cwd;
+    std::vector<std::string> args;
+    int fds[3];
+};
+
+bool send_request(int socket, const ServerRequest& request);
+
+/**
+ * @return bool - false if the client went away or sent garbage, no
+ * descriptors are left open then.
+ */
+bool receive_request(int socket, ServerRequest& request);
+
+bool send_status(int socket, int status);
+bool receive_status(int socket, int& status);
+#endif
@@ -0,0 +1,45 @@
+#ifndef STRING_SEARCH_H
+#define STRING_SEARCH_H
+#include <string>
+
+
+/**
+ * Repeated searches for one needle in one haystack, as done by InStr,
+ * Replace, Split and Filter.
+ *
+ * In text mode (`compare` 1) both are case folded once up front,
+ * so every search runs over plain bytes with simd_find.
+ */
+class StringSearch {
+    public:
+        StringSearch(const std::string& haystack, const std::string& needle, bool text);
+
+        /**
+         * @return size_t - offset of the next occurrence at or after
+         * `from`, std::string::npos if there is none.
+         */
+        size_t find(size_t from);
+
+        size_t needle_length();
+
+    private:
+        const std::string* haystack;
+        const std::string* needle;
+
+        std::string folded_haystack;
+        std::string folded_needle;
+};
+
+/**
+ * ASCII case folding into a new string, used by LCase/UCase.
+ */
+std::string string_lower(const std::string& value);
+std::string string_upper(const std::string& value);
+
+/**
+ * @param bool text - ignore ASCII case.
+ *
+ * @return int - -1, 0 or 1 like StrComp.
+ */
+int string_compare(const std::string& left, const std::string& right, bool text);
+#endif
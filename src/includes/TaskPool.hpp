@@ -0,0 +1,86 @@
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+#include "Program.hpp"
+#include "ExecutionContext.hpp"
+#include "Output.hpp"
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+
+/**
+ * Worker threads that run the script functions submitted with
+ * `CreateObject("WScript.TaskPool")`, shared by every script of the
+ * process.
+ *
+ * A task runs in an ExecutionContext of the worker, started from a
+ * snapshot of the submitting context, so it sees the globals as they
+ * were when it was submitted and its own changes stay its own: the
+ * objects it gets are copies (see ExecutionContext::share). The
+ * Program is shared, running a function does not change it.
+ *
+ * Waiting for a task that no worker has started yet runs it on the
+ * waiting thread, so tasks that wait for other tasks can not run out
+ * of workers.
+ */
+class TaskPool {
+    public:
+        struct Task {
+            Program* program;
+            AST_FunctionDefinition* definition;
+            std::vector<anything> args;
+
+            /* freed once the task started */
+            ExecutionContext::Snapshot* snapshot;
+
+            enum State { Queued, Running, Done } state;
+
+            anything result;
+
+            /* why the task failed, empty if it did not */
+            std::string error;
+
+            /* what the task wrote, freed once it was waited for */
+            Output* output;
+            Output* errors;
+
+            /* set once the output was handed on */
+            std::atomic<bool> emitted;
+        };
+
+        /**
+         * @return TaskPool* - started on first use with one worker per
+         * CPU, or WSCRIPT_TASK_THREADS workers.
+         */
+        static TaskPool* instance();
+
+        size_t threads;
+
+        void submit(Task* task);
+
+        /**
+         * Returns once `task` is done, running it here if it was not
+         * started yet.
+         */
+        void wait(Task* task);
+
+        /**
+         * @return bool - whether `task` is done, without waiting.
+         */
+        bool done(Task* task);
+
+    private:
+        TaskPool(size_t threads);
+
+        std::mutex lock;
+        std::condition_variable queued;
+        std::condition_variable finished;
+        std::deque<Task*> tasks;
+
+        void work();
+        void run(Task* task, ExecutionContext* context);
+};
+#endif
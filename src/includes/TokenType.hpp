@@ -50,6 +50,20 @@ enum TokenType
     While,
     Loop,
     Colon,
+    Redim,
+    Preserve,
+    For,
+    Each,
+    In,
+    Next,
+    Class,
+    Public,
+    Private,
+    Property,
+    New,
+    Me,
+    Set,
+    With,
     Anything
 };
 #endif
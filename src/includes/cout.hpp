@@ -6,8 +6,15 @@
 #include "AST/AST_Array.hpp"
 
 
+class Output;
+
 void coutprint(anything value);
 
+/**
+ * Writes `value` and a newline to `out`.
+ */
+void coutprint(Output* out, anything value);
+
 void coutprint(std::string value);
 
 void coutprint_char(char value);
@@ -0,0 +1,15 @@
+#ifndef INTERN_H
+#define INTERN_H
+#include <string>
+
+
+/**
+ * Interned, lowercased names.
+ *
+ * Every distinct name is stored once for the lifetime of the process,
+ * so two atoms are equal exactly when their pointers are equal.
+ */
+typedef const std::string* Atom;
+
+Atom intern(std::string name);
+#endif
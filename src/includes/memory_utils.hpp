@@ -1,5 +1,70 @@
+#ifndef MEMORY_UTILS_H
+#define MEMORY_UTILS_H
+#include <vector>
+#include <algorithm>
+
+
 template <class classType>
 void free_vector(std::vector<classType> vec) {
     vec.clear();
     std::vector<classType>(vec).swap(vec);
 };
+
+/**
+ * Resizes a row-major buffer to new dimensions.
+ *
+ * Without `preserve` every element is reset to `empty`, the existing buffer
+ * is reused when it is large enough.
+ *
+ * With `preserve` only the last dimension may change and existing elements
+ * keep their indices. The buffer grows geometrically so that growing one
+ * element at a time is amortized O(1).
+ *
+ * @param std::vector<classType>& buffer
+ * @param size_t old_columns - current size of the last dimension
+ * @param std::vector<int> dimensions - number of elements per dimension
+ * @param bool preserve
+ * @param classType empty - value of new elements
+ */
+template <class classType>
+void redim_buffer(std::vector<classType>& buffer, size_t old_columns, std::vector<int> dimensions, bool preserve, classType empty) {
+    size_t new_size = 1;
+
+    for (std::vector<int>::iterator it = dimensions.begin(); it != dimensions.end(); ++it)
+        new_size *= (*it);
+
+    if (!preserve || buffer.empty()) {
+        buffer.assign(new_size, empty);
+        return;
+    }
+
+    size_t new_columns = dimensions[dimensions.size() - 1];
+    size_t rows = new_columns == 0 ? 0 : new_size / new_columns;
+
+    if (new_size > buffer.capacity())
+        buffer.reserve(std::max(new_size, buffer.capacity() * 2));
+
+    if (new_columns > old_columns) {
+        buffer.resize(new_size, empty);
+
+        // move rows to their new position, starting with the last one so
+        // that nothing is overwritten before it has been moved.
+        for (size_t row = rows; row-- > 1;) {
+            for (size_t column = old_columns; column-- > 0;)
+                buffer[row * new_columns + column] = buffer[row * old_columns + column];
+
+            for (size_t column = old_columns; column < new_columns; column++)
+                buffer[row * new_columns + column] = empty;
+        }
+
+        for (size_t column = old_columns; column < new_columns && rows > 1; column++)
+            buffer[column] = empty;
+    } else if (new_columns < old_columns) {
+        for (size_t row = 1; row < rows; row++)
+            for (size_t column = 0; column < new_columns; column++)
+                buffer[row * new_columns + column] = buffer[row * old_columns + column];
+
+        buffer.resize(new_size);
+    }
+};
+#endif
@@ -0,0 +1,54 @@
+#ifndef NUMCONV_H
+#define NUMCONV_H
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Conversions between numbers and text without iostreams or locales.
+ *
+ * Formatting follows VBScript: floats print the shortest digits that
+ * read back as the same value (Ryu), in fixed notation for decimal
+ * exponents from -5 to 14 and as `1.5E+20` / `1E-07` otherwise.
+ */
+
+/**
+ * Large enough for any value written by format_int or format_float.
+ */
+static const size_t NUMBER_BUFFER_SIZE = 32;
+
+/**
+ * Writes `value` to `buffer` without a terminating NUL.
+ *
+ * @return char* - one past the last character written.
+ */
+char* format_int(char* buffer, int64_t value);
+
+/**
+ * @see format_int
+ */
+char* format_float(char* buffer, float value);
+
+std::string int_to_string(int64_t value);
+
+std::string float_to_string(float value);
+
+/**
+ * Parses a decimal integer from [first, last), like std::from_chars.
+ *
+ * @return const char* - one past the last character parsed, `first` if
+ * there is no number or it does not fit into an int.
+ */
+const char* parse_int(const char* first, const char* last, int& value);
+
+/**
+ * Parses a number from [first, last), accepting everything strtod does.
+ * Plain decimal literals with up to 19 significant digits are converted
+ * exactly without calling strtod.
+ *
+ * @return const char* - one past the last character parsed, `first` if
+ * there is no number.
+ */
+const char* parse_double(const char* first, const char* last, double& value);
+#endif
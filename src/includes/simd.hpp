@@ -0,0 +1,44 @@
+#ifndef SIMD_H
+#define SIMD_H
+#include <stddef.h>
+
+
+/**
+ * Reductions over contiguous buffers of doubles.
+ *
+ * Uses AVX2 when the CPU running the interpreter supports it,
+ * and a portable scalar loop otherwise.
+ */
+
+double simd_sum(const double* values, size_t length);
+
+double simd_min(const double* values, size_t length);
+
+double simd_max(const double* values, size_t length);
+
+double simd_dot(const double* left, const double* right, size_t length);
+
+bool simd_has_avx2();
+
+/**
+ * Byte string search and ASCII case folding, used by the string
+ * builtins. Bytes outside of ASCII are left alone.
+ */
+
+/**
+ * @return const char* - first occurrence of `needle` in `haystack`,
+ * nullptr if there is none.
+ */
+const char* simd_find(const char* haystack, size_t length, const char* needle, size_t needle_length);
+
+void simd_lower(char* destination, const char* source, size_t length);
+
+void simd_upper(char* destination, const char* source, size_t length);
+
+/**
+ * Compares two buffers of the same length ignoring ASCII case.
+ *
+ * @return int - negative, zero or positive like memcmp.
+ */
+int simd_compare_folded(const char* left, const char* right, size_t length);
+#endif
@@ -0,0 +1,119 @@
+#ifndef WSCRIPT_EMBED_H
+#define WSCRIPT_EMBED_H
+#include "wscript_extension.h"
+
+/**
+ * Embedding API, for programs that link libwscript.so and run scripts
+ * themselves.
+ *
+ * A script is compiled once into a `ws_script` and can then be run any
+ * number of times, also on several threads at once. Every run happens
+ * in a `ws_context`: the script's variables, functions and output
+ * buffers. Contexts are taken from a `ws_pool` and given back after the
+ * run, a context that is taken again is cleared instead of being
+ * allocated again, the builtins are not set up again either.
+ *
+ *     ws_script* script = ws_compile(source, size, &error);
+ *     ws_pool* pool = ws_pool_create(16);
+ *
+ *     ws_variable variables[] = { { "amount", { WS_INT, { .integer = 42 } } } };
+ *     ws_run_options options = { variables, 1, write_output, NULL, host };
+ *
+ *     ws_context* context = ws_acquire(pool);
+ *     if (ws_run(context, script, &options, &error) != 0)
+ *         ...
+ *     ws_get(context, "result", &value);
+ *     ws_release(pool, context);
+ *
+ * Error messages are allocated with malloc and freed by the caller with
+ * free. A pool can be used from any thread, a context by one thread at
+ * a time.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ws_script ws_script;
+typedef struct ws_context ws_context;
+typedef struct ws_pool ws_pool;
+
+/**
+ * Receives what the script writes, `data` is only valid during the call.
+ */
+typedef void ws_write_fn(void* user, const char* data, size_t size);
+
+typedef struct ws_variable {
+    /* Case does not matter, the interpreter lowercases identifiers. */
+    const char* name;
+
+    /*
+     * WS_EMPTY, WS_BOOL, WS_INT, WS_DOUBLE, WS_STRING or WS_BYTES, copied.
+     * Scripts compute with Single precision, ws_run fails for a double
+     * that can not be stored as a float without changing.
+     */
+    ws_value value;
+} ws_variable;
+
+typedef struct ws_run_options {
+    /* Global variables defined before the script starts. */
+    const ws_variable* variables;
+    size_t variable_count;
+
+    /* Print, WScript.Echo and StdOut, discarded if NULL. */
+    ws_write_fn* output;
+
+    /* WScript.StdErr, discarded if NULL. */
+    ws_write_fn* error;
+
+    void* user;
+} ws_run_options;
+
+/**
+ * @return ws_script* - NULL with `*error` set on syntax errors.
+ */
+WSCRIPT_EXPORT ws_script* ws_compile(const char* source, size_t size, char** error);
+
+/**
+ * No context may be running the script any more.
+ */
+WSCRIPT_EXPORT void ws_script_free(ws_script* script);
+
+/**
+ * @param size_t max_idle - contexts kept for reuse, more are freed when
+ * they are released.
+ */
+WSCRIPT_EXPORT ws_pool* ws_pool_create(size_t max_idle);
+
+/**
+ * Contexts that were not released are not freed.
+ */
+WSCRIPT_EXPORT void ws_pool_free(ws_pool* pool);
+
+WSCRIPT_EXPORT ws_context* ws_acquire(ws_pool* pool);
+WSCRIPT_EXPORT void ws_release(ws_pool* pool, ws_context* context);
+
+/**
+ * Clears what the previous run left in `context` and runs `script`.
+ * Output is passed to the callbacks in large pieces while the script
+ * runs, and what is left at the end of the run.
+ *
+ * @param const ws_run_options* options - may be NULL.
+ *
+ * @return int - 0 on success, -1 with `*error` set if the script failed.
+ */
+WSCRIPT_EXPORT int ws_run(ws_context* context, const ws_script* script, const ws_run_options* options, char** error);
+
+/**
+ * Reads a global variable after a run. Strings point into the context
+ * and are valid until it is run again or released, arrays and objects
+ * are reported as WS_EMPTY. WS_DOUBLE values have Single precision.
+ *
+ * @return int - 0 if the variable is not defined.
+ */
+WSCRIPT_EXPORT int ws_get(ws_context* context, const char* name, ws_value* value);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
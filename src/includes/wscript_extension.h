@@ -0,0 +1,116 @@
+#ifndef WSCRIPT_EXTENSION_H
+#define WSCRIPT_EXTENSION_H
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Native extension ABI.
+ *
+ * An extension is a shared library that exports `wscript_module`,
+ * a function returning a static description of the object class it
+ * implements:
+ *
+ *     static const ws_method methods[] = {
+ *         { "open", 3, requests_open },
+ *         { "send", 0, requests_send },
+ *         { "responsetext", 0, requests_response_text }
+ *     };
+ *
+ *     static const ws_module module = {
+ *         WSCRIPT_ABI_VERSION, "Requests",
+ *         requests_create, requests_destroy,
+ *         methods, sizeof(methods) / sizeof(methods[0])
+ *     };
+ *
+ *     WSCRIPT_MODULE(requests) { return &module; }
+ *
+ * The interpreter evaluates the arguments before calling a method,
+ * strings and byte arrays are borrowed spans that are only valid for
+ * the duration of the call. Returned strings and byte buffers stay
+ * owned by the extension until `release` is called with `owner`, which
+ * lets an extension hand out a buffer it already holds without copying.
+ *
+ * Compiled with WSCRIPT_STATIC, WSCRIPT_MODULE(name) defines
+ * `wscript_module_<name>` instead, so several extensions can be linked
+ * into the interpreter (see AST_Function_CreateObject).
+ *
+ * Libraries that only export `create`/`destroy` are loaded through the
+ * old AST_ObjectCustom interface.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WSCRIPT_ABI_VERSION 2
+#define WSCRIPT_MODULE_SYMBOL "wscript_module"
+
+#define WSCRIPT_EXPORT __attribute__((visibility("default")))
+
+#ifdef WSCRIPT_STATIC
+#define WSCRIPT_MODULE(name) const struct ws_module* wscript_module_##name(void)
+#else
+#define WSCRIPT_MODULE(name) WSCRIPT_EXPORT const struct ws_module* wscript_module(void)
+#endif
+
+typedef enum ws_type {
+    WS_EMPTY,
+    WS_BOOL,
+    WS_INT,
+    WS_DOUBLE,
+    WS_STRING,
+    WS_BYTES,
+    /* A returned error, `as.span` holds the message. */
+    WS_ERROR
+} ws_type;
+
+typedef struct ws_span {
+    const char* data;
+    size_t size;
+} ws_span;
+
+typedef struct ws_value {
+    ws_type type;
+
+    union {
+        int boolean;
+        int integer;
+        double number;
+        ws_span span;
+    } as;
+
+    /* Called once the interpreter no longer needs `as.span`, may be NULL. */
+    void (*release)(void* owner);
+    void* owner;
+} ws_value;
+
+/**
+ * @param void* self - the instance returned by `create`.
+ * @param const ws_value* args - exactly `arity` evaluated arguments.
+ */
+typedef ws_value ws_native_fn(void* self, const ws_value* args);
+
+typedef struct ws_method {
+    /* Lowercase, the interpreter lowercases identifiers. */
+    const char* name;
+    int arity;
+    ws_native_fn* fn;
+} ws_method;
+
+typedef struct ws_module {
+    uint32_t abi_version;
+    const char* class_name;
+
+    void* (*create)(void);
+    void (*destroy)(void* self);
+
+    const ws_method* methods;
+    size_t method_count;
+} ws_module;
+
+typedef const ws_module* ws_module_entry_t(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -5,6 +5,18 @@
 #include "includes/AST/AST_Function_CreateObject.hpp"
 #include "includes/AST/AST_Function_Print.hpp"
 #include "includes/AST/AST_Function_Array.hpp"
+#include "includes/AST/AST_Function_Aggregate.hpp"
+#include "includes/AST/AST_Function_Dot.hpp"
+#include "includes/AST/AST_Function_CDbl.hpp"
+#include "includes/AST/AST_Function_CInt.hpp"
+#include "includes/AST/AST_Function_CStr.hpp"
+#include "includes/AST/AST_Function_Join.hpp"
+#include "includes/AST/AST_Function_InStr.hpp"
+#include "includes/AST/AST_Function_Replace.hpp"
+#include "includes/AST/AST_Function_Mid.hpp"
+#include "includes/AST/AST_Function_ChangeCase.hpp"
+#include "includes/AST/AST_Function_StrComp.hpp"
+#include "includes/AST/AST_Function_Filter.hpp"
 
 
 void initialize_scope(Scope* scope) {
@@ -14,4 +26,20 @@ void initialize_scope(Scope* scope) {
     scope->define_builtin_function(new AST_Function_CreateObject("createobject"));
     scope->define_builtin_function(new AST_Function_Print("print"));
     scope->define_builtin_function(new AST_Function_Array("array"));
+    scope->define_builtin_function(new AST_Function_Aggregate("sum"));
+    scope->define_builtin_function(new AST_Function_Aggregate("min"));
+    scope->define_builtin_function(new AST_Function_Aggregate("max"));
+    scope->define_builtin_function(new AST_Function_Aggregate("avg"));
+    scope->define_builtin_function(new AST_Function_Dot("dot"));
+    scope->define_builtin_function(new AST_Function_CDbl("cdbl"));
+    scope->define_builtin_function(new AST_Function_CInt("cint"));
+    scope->define_builtin_function(new AST_Function_CStr("cstr"));
+    scope->define_builtin_function(new AST_Function_Join("join"));
+    scope->define_builtin_function(new AST_Function_InStr("instr"));
+    scope->define_builtin_function(new AST_Function_Replace("replace"));
+    scope->define_builtin_function(new AST_Function_Mid("mid"));
+    scope->define_builtin_function(new AST_Function_ChangeCase("lcase"));
+    scope->define_builtin_function(new AST_Function_ChangeCase("ucase"));
+    scope->define_builtin_function(new AST_Function_StrComp("strcomp"));
+    scope->define_builtin_function(new AST_Function_Filter("filter"));
 };
@@ -0,0 +1,17 @@
+#include "includes/intern.hpp"
+#include <unordered_set>
+#include <algorithm>
+#include <mutex>
+
+
+Atom intern(std::string name) {
+    static std::unordered_set<std::string>* names = new std::unordered_set<std::string>();
+    static std::mutex lock;
+
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    // elements of an unordered_set never move, even when it rehashes
+    return &*names->insert(name).first;
+};
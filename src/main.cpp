@@ -1,37 +1,81 @@
 #include <iostream>
 #include <ResourceManager.h>
-#include "includes/TOKEN_TYPES.hpp"
-#include "includes/Parser.hpp"
+#include "includes/Program.hpp"
 #include "includes/Interpreter.hpp"
-#include "includes/Scope.hpp"
-#include "includes/initialize_scope.hpp"
+#include "includes/ExecutionContext.hpp"
+#include "includes/ModuleCache.hpp"
+#include "includes/Output.hpp"
+#include "includes/RecordLoop.hpp"
+#include "includes/Options.hpp"
+#include "includes/Server.hpp"
+#include "includes/Client.hpp"
+#include "includes/BatchRunner.hpp"
+#include "includes/PreforkSupervisor.hpp"
+#include <cstdlib>
 
 
-Scope* global_scope;
-
 int main(int argc, char** argv) {
-    if (argc < 2) {
+    Options options;
+    std::string error;
+
+    if (!parse_options(std::vector<std::string>(argv + 1, argv + argc), options, error)) {
+        std::cerr << error << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    if (!options.client.empty())
+        return Client::run(options.client, options.forwarded);
+
+    if (!options.serve.empty())
+        return Server(options.serve).serve();
+
+    if (!options.batch.empty() && options.processes > 0)
+        return PreforkSupervisor(options.batch, options.processes).run();
+
+    if (!options.batch.empty())
+        return BatchRunner(options.batch, options.threads).run();
+
+    if (options.has_policy)
+        Output::standard()->policy = options.policy;
+
+    if (options.filename.empty()) {
         std::cout << "no input file" << std::endl;
         
         return EXIT_FAILURE;
     }
 
-    ResourceManager::load(argv[1]);
+    const char* filename = options.filename.c_str();
+
+    ResourceManager::load(filename);
 
-    global_scope = new Scope("global");
-    initialize_scope(global_scope);
+    Program* program = new Program(ResourceManager::get(filename));
+    ExecutionContext* context = new ExecutionContext(Output::standard());
+    Interpreter* interpreter = new Interpreter(program, context);
 
-    Lexer* lexer = new Lexer(ResourceManager::get(argv[1]));
-    Parser* parser = new Parser(lexer);
-    Interpreter* interpreter = new Interpreter(parser);
+    if (options.records) {
+        RecordLoop loop(interpreter, options.print);
+        loop.run(program->tree, options.inputs);
+    } else {
+        interpreter->interpret();
+    }
+
+    ResourceManager::unload(filename);
 
-    interpreter->interpret();
+    if (getenv("WSCRIPT_STATS") != nullptr) {
+        ModuleCache::Stats* stats = &ModuleCache::instance()->stats;
+
+        std::cerr << "modules loaded: " << stats->loads
+            << ", prefetched: " << stats->prefetches
+            << ", cache hits: " << stats->hits
+            << ", load time: " << stats->load_nanoseconds / 1000 << "us" << std::endl;
+    }
 
-    ResourceManager::unload(argv[1]);
+    Output::standard()->flush();
 
     // undefined behaviour
     //delete interpreter;
-    delete global_scope;
+    delete context;
 
     return EXIT_SUCCESS;
 }
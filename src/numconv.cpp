@@ -0,0 +1,506 @@
+#include "includes/numconv.hpp"
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include <ctype.h>
+
+
+static const char DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @return int - number of decimal digits in `value`.
+ */
+static int decimal_length(uint64_t value) {
+    int length = 1;
+
+    while (value >= 10) {
+        value /= 10;
+        length++;
+    }
+
+    return length;
+};
+
+/**
+ * Writes the `length` digits of `value` ending at `end`, two at a time.
+ */
+static void write_digits(char* end, uint64_t value) {
+    while (value >= 100) {
+        unsigned int pair = (value % 100) * 2;
+        value /= 100;
+        *--end = DIGIT_PAIRS[pair + 1];
+        *--end = DIGIT_PAIRS[pair];
+    }
+
+    if (value >= 10) {
+        *--end = DIGIT_PAIRS[value * 2 + 1];
+        *--end = DIGIT_PAIRS[value * 2];
+    } else {
+        *--end = '0' + value;
+    }
+};
+
+char* format_int(char* buffer, int64_t value) {
+    uint64_t magnitude = (uint64_t)value;
+
+    if (value < 0) {
+        *buffer++ = '-';
+        magnitude = 0 - magnitude;
+    }
+
+    int length = decimal_length(magnitude);
+    write_digits(buffer + length, magnitude);
+
+    return buffer + length;
+};
+
+/*
+ * Shortest round trip float formatting, following Ulf Adams' Ryu
+ * (f2s). The tables of powers of five are computed once at startup
+ * instead of being spelled out.
+ */
+
+static const int FLOAT_MANTISSA_BITS = 23;
+static const int FLOAT_EXPONENT_BITS = 8;
+static const int FLOAT_BIAS = 127;
+
+static const int FLOAT_POW5_INV_BITCOUNT = 59;
+static const int FLOAT_POW5_BITCOUNT = 61;
+
+static const int FLOAT_POW5_INV_TABLE_SIZE = 31;
+static const int FLOAT_POW5_TABLE_SIZE = 48;
+
+/**
+ * @return int32_t - ceil(log2(5^e)), the bit length of 5^e.
+ */
+static int32_t pow5bits(int32_t e) {
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+};
+
+static uint32_t log10_pow2(int32_t e) {
+    return ((uint32_t)e * 78913) >> 18;
+};
+
+static uint32_t log10_pow5(int32_t e) {
+    return ((uint32_t)e * 732923) >> 20;
+};
+
+struct Pow5Tables {
+    uint64_t inv_split[FLOAT_POW5_INV_TABLE_SIZE];
+    uint64_t split[FLOAT_POW5_TABLE_SIZE];
+
+    Pow5Tables() {
+        unsigned __int128 pow5 = 1;
+
+        for (int i = 0; i < FLOAT_POW5_TABLE_SIZE; i++) {
+            int shift = pow5bits(i) - FLOAT_POW5_BITCOUNT;
+            this->split[i] = (uint64_t)(shift >= 0 ? pow5 >> shift : pow5 << -shift);
+
+            if (i < FLOAT_POW5_INV_TABLE_SIZE) {
+                // 2^j / 5^i + 1 where j can be 128, so divide 2^(j-1)
+                // and double the result
+                int j = pow5bits(i) - 1 + FLOAT_POW5_INV_BITCOUNT;
+                unsigned __int128 half = (unsigned __int128)1 << (j - 1);
+                unsigned __int128 quotient = half / pow5;
+                unsigned __int128 remainder = half % pow5;
+
+                this->inv_split[i] = (uint64_t)(quotient * 2 + (remainder * 2 >= pow5 ? 1 : 0)) + 1;
+            }
+
+            pow5 *= 5;
+        }
+    };
+};
+
+static const Pow5Tables& pow5_tables() {
+    static const Pow5Tables tables;
+
+    return tables;
+};
+
+static uint32_t pow5_factor(uint32_t value) {
+    uint32_t count = 0;
+
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+
+    return count;
+};
+
+static bool multiple_of_pow5(uint32_t value, uint32_t p) {
+    return pow5_factor(value) >= p;
+};
+
+static bool multiple_of_pow2(uint32_t value, uint32_t p) {
+    return (value & ((1u << p) - 1)) == 0;
+};
+
+static uint32_t mul_shift(uint32_t m, uint64_t factor, int32_t shift) {
+    uint64_t low = (uint64_t)m * (uint32_t)factor;
+    uint64_t high = (uint64_t)m * (uint32_t)(factor >> 32);
+    uint64_t sum = (low >> 32) + high;
+
+    return (uint32_t)(sum >> (shift - 32));
+};
+
+/**
+ * Shortest decimal `digits` * 10^`exponent` that rounds to the float
+ * with the given (finite, non-zero) IEEE fields.
+ */
+static void shortest_digits(uint32_t ieee_mantissa, uint32_t ieee_exponent, uint32_t& digits, int32_t& exponent) {
+    const Pow5Tables& tables = pow5_tables();
+
+    int32_t e2;
+    uint32_t m2;
+
+    if (ieee_exponent == 0) {
+        e2 = 1 - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
+    } else {
+        e2 = (int32_t)ieee_exponent - FLOAT_BIAS - FLOAT_MANTISSA_BITS - 2;
+        m2 = (1u << FLOAT_MANTISSA_BITS) | ieee_mantissa;
+    }
+
+    bool accept_bounds = (m2 & 1) == 0;
+
+    uint32_t mv = 4 * m2;
+    uint32_t mp = 4 * m2 + 2;
+    uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+    uint32_t vr, vp, vm;
+    int32_t e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+    uint32_t last_removed_digit = 0;
+
+    if (e2 >= 0) {
+        uint32_t q = log10_pow2(e2);
+        e10 = (int32_t)q;
+        int32_t k = FLOAT_POW5_INV_BITCOUNT + pow5bits(q) - 1;
+        int32_t i = -e2 + (int32_t)q + k;
+
+        vr = mul_shift(mv, tables.inv_split[q], i);
+        vp = mul_shift(mp, tables.inv_split[q], i);
+        vm = mul_shift(mm, tables.inv_split[q], i);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            int32_t l = FLOAT_POW5_INV_BITCOUNT + pow5bits(q - 1) - 1;
+            last_removed_digit = mul_shift(mv, tables.inv_split[q - 1], -e2 + (int32_t)q - 1 + l) % 10;
+        }
+
+        if (q <= 9) {
+            if (mv % 5 == 0)
+                vr_trailing_zeros = multiple_of_pow5(mv, q);
+            else if (accept_bounds)
+                vm_trailing_zeros = multiple_of_pow5(mm, q);
+            else
+                vp -= multiple_of_pow5(mp, q);
+        }
+    } else {
+        uint32_t q = log10_pow5(-e2);
+        e10 = (int32_t)q + e2;
+        int32_t i = -e2 - (int32_t)q;
+        int32_t k = pow5bits(i) - FLOAT_POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+
+        vr = mul_shift(mv, tables.split[i], j);
+        vp = mul_shift(mp, tables.split[i], j);
+        vm = mul_shift(mm, tables.split[i], j);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            j = (int32_t)q - 1 - (pow5bits(i + 1) - FLOAT_POW5_BITCOUNT);
+            last_removed_digit = mul_shift(mv, tables.split[i + 1], j) % 10;
+        }
+
+        if (q <= 1) {
+            vr_trailing_zeros = true;
+
+            if (accept_bounds)
+                vm_trailing_zeros = mm_shift == 1;
+            else
+                vp--;
+        } else if (q < 31) {
+            vr_trailing_zeros = multiple_of_pow2(mv, q - 1);
+        }
+    }
+
+    int32_t removed = 0;
+    uint32_t output;
+
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+
+        // round half to even when the removed digits are exactly 5000...
+        if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+            last_removed_digit = 4;
+
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+    } else {
+        while (vp / 10 > vm / 10) {
+            last_removed_digit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        output = vr + (vr == vm || last_removed_digit >= 5);
+    }
+
+    digits = output;
+    exponent = e10 + removed;
+};
+
+char* format_float(char* buffer, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    bool negative = (bits >> 31) != 0;
+    uint32_t ieee_mantissa = bits & ((1u << FLOAT_MANTISSA_BITS) - 1);
+    uint32_t ieee_exponent = (bits >> FLOAT_MANTISSA_BITS) & ((1u << FLOAT_EXPONENT_BITS) - 1);
+
+    if (ieee_exponent == (1u << FLOAT_EXPONENT_BITS) - 1) {
+        const char* text = ieee_mantissa != 0 ? "nan" : negative ? "-inf" : "inf";
+        size_t length = strlen(text);
+        memcpy(buffer, text, length);
+
+        return buffer + length;
+    }
+
+    if (ieee_exponent == 0 && ieee_mantissa == 0) {
+        *buffer = '0';
+        return buffer + 1;
+    }
+
+    uint32_t digits;
+    int32_t exponent;
+    shortest_digits(ieee_mantissa, ieee_exponent, digits, exponent);
+
+    if (negative)
+        *buffer++ = '-';
+
+    int length = decimal_length(digits);
+    // decimal exponent of the first digit
+    int32_t scientific = exponent + length - 1;
+
+    if (scientific < -5 || scientific >= 15) {
+        // 1.2345E+20
+        write_digits(buffer + length + 1, digits);
+        buffer[0] = buffer[1];
+
+        if (length > 1) {
+            buffer[1] = '.';
+            buffer += length + 1;
+        } else {
+            buffer += 1;
+        }
+
+        *buffer++ = 'E';
+        *buffer++ = scientific < 0 ? '-' : '+';
+
+        int32_t magnitude = scientific < 0 ? -scientific : scientific;
+
+        if (magnitude < 10)
+            *buffer++ = '0';
+
+        return format_int(buffer, magnitude);
+    }
+
+    if (exponent >= 0) {
+        // 12300
+        write_digits(buffer + length, digits);
+        memset(buffer + length, '0', exponent);
+
+        return buffer + length + exponent;
+    }
+
+    if (scientific >= 0) {
+        // 12.3
+        int32_t integral = scientific + 1;
+        write_digits(buffer + length + 1, digits);
+        memmove(buffer, buffer + 1, integral);
+        buffer[integral] = '.';
+
+        return buffer + length + 1;
+    }
+
+    // 0.00123
+    int32_t zeros = -scientific - 1;
+    buffer[0] = '0';
+    buffer[1] = '.';
+    memset(buffer + 2, '0', zeros);
+    write_digits(buffer + 2 + zeros + length, digits);
+
+    return buffer + 2 + zeros + length;
+};
+
+std::string int_to_string(int64_t value) {
+    char buffer[NUMBER_BUFFER_SIZE];
+
+    return std::string(buffer, format_int(buffer, value));
+};
+
+std::string float_to_string(float value) {
+    char buffer[NUMBER_BUFFER_SIZE];
+
+    return std::string(buffer, format_float(buffer, value));
+};
+
+const char* parse_int(const char* first, const char* last, int& value) {
+    const char* it = first;
+    bool negative = false;
+
+    if (it != last && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        it++;
+    }
+
+    const char* digits = it;
+    uint64_t magnitude = 0;
+
+    while (it != last && *it >= '0' && *it <= '9') {
+        magnitude = magnitude * 10 + (*it - '0');
+
+        if (magnitude > (uint64_t)INT_MAX + 1)
+            return first;
+
+        it++;
+    }
+
+    if (it == digits || (!negative && magnitude > (uint64_t)INT_MAX))
+        return first;
+
+    value = negative ? (int)(0 - magnitude) : (int)magnitude;
+
+    return it;
+};
+
+static const double EXACT_POWERS_OF_TEN[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const char* parse_double_strtod(const char* first, const char* last, double& value) {
+    std::string copy(first, last);
+    char* end = nullptr;
+    double number = strtod(copy.c_str(), &end);
+
+    if (end == copy.c_str())
+        return first;
+
+    value = number;
+
+    return first + (end - copy.c_str());
+};
+
+/**
+ * Clinger's fast path: a mantissa below 2^53 scaled by an exactly
+ * representable power of ten rounds correctly in one operation.
+ */
+const char* parse_double(const char* first, const char* last, double& value) {
+    const char* it = first;
+    bool negative = false;
+
+    if (it != last && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        it++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int32_t exponent = 0;
+    const char* digits = it;
+
+    while (it != last && *it >= '0' && *it <= '9') {
+        if (mantissa != 0 || *it != '0') {
+            mantissa = mantissa * 10 + (*it - '0');
+            significant++;
+        }
+
+        it++;
+    }
+
+    bool any_digits = it != digits;
+
+    if (it != last && *it == '.') {
+        it++;
+        const char* fraction = it;
+
+        while (it != last && *it >= '0' && *it <= '9') {
+            if (mantissa != 0 || *it != '0') {
+                mantissa = mantissa * 10 + (*it - '0');
+                significant++;
+            }
+
+            exponent--;
+            it++;
+        }
+
+        any_digits = any_digits || it != fraction;
+    }
+
+    if (!any_digits || significant > 19)
+        return parse_double_strtod(first, last, value);
+
+    if (it != last && (*it == 'e' || *it == 'E')) {
+        int exponent_value = 0;
+        const char* end = parse_int(it + 1, last, exponent_value);
+
+        if (end == it + 1)
+            return parse_double_strtod(first, last, value);
+
+        exponent += exponent_value;
+        it = end;
+    }
+
+    if (mantissa > ((uint64_t)1 << 53) || exponent < -22 || exponent > 22)
+        return parse_double_strtod(first, last, value);
+
+    // strtod also accepts hex and inf/nan, which start like a number here
+    if (it != last && (*it == 'x' || *it == 'X' || isalpha((unsigned char)*it)))
+        return parse_double_strtod(first, last, value);
+
+    double number = (double)mantissa;
+
+    if (exponent < 0)
+        number /= EXACT_POWERS_OF_TEN[-exponent];
+    else
+        number *= EXACT_POWERS_OF_TEN[exponent];
+
+    value = negative ? -number : number;
+
+    return it;
+};
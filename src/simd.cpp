@@ -0,0 +1,341 @@
+#include "includes/simd.hpp"
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#endif
+
+
+bool simd_has_avx2() {
+#ifdef SIMD_X86
+    static const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+
+    return has_avx2;
+#else
+    return false;
+#endif
+};
+
+static double scalar_sum(const double* values, size_t length) {
+    double sum = 0;
+
+    for (size_t i = 0; i < length; i++)
+        sum += values[i];
+
+    return sum;
+};
+
+static double scalar_min(const double* values, size_t length) {
+    double min = values[0];
+
+    for (size_t i = 1; i < length; i++)
+        if (values[i] < min)
+            min = values[i];
+
+    return min;
+};
+
+static double scalar_max(const double* values, size_t length) {
+    double max = values[0];
+
+    for (size_t i = 1; i < length; i++)
+        if (values[i] > max)
+            max = values[i];
+
+    return max;
+};
+
+static double scalar_dot(const double* left, const double* right, size_t length) {
+    double dot = 0;
+
+    for (size_t i = 0; i < length; i++)
+        dot += left[i] * right[i];
+
+    return dot;
+};
+
+static char scalar_lower(char c) {
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+};
+
+static char scalar_upper(char c) {
+    return c >= 'a' && c <= 'z' ? c - ('a' - 'A') : c;
+};
+
+static int scalar_compare_folded(const char* left, const char* right, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        unsigned char l = scalar_lower(left[i]);
+        unsigned char r = scalar_lower(right[i]);
+
+        if (l != r)
+            return l < r ? -1 : 1;
+    }
+
+    return 0;
+};
+
+#ifdef SIMD_X86
+__attribute__((target("avx2,fma")))
+static double horizontal_sum(__m256d x) {
+    __m128d low = _mm256_castpd256_pd128(x);
+    __m128d high = _mm256_extractf128_pd(x, 1);
+    low = _mm_add_pd(low, high);
+
+    return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+};
+
+__attribute__((target("avx2,fma")))
+static double avx2_sum(const double* values, size_t length) {
+    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd();
+    __m256d c = _mm256_setzero_pd(), d = _mm256_setzero_pd();
+    size_t i = 0;
+
+    // four independent accumulators hide the latency of the adds
+    for (; i + 16 <= length; i += 16) {
+        a = _mm256_add_pd(a, _mm256_loadu_pd(values + i));
+        b = _mm256_add_pd(b, _mm256_loadu_pd(values + i + 4));
+        c = _mm256_add_pd(c, _mm256_loadu_pd(values + i + 8));
+        d = _mm256_add_pd(d, _mm256_loadu_pd(values + i + 12));
+    }
+
+    for (; i + 4 <= length; i += 4)
+        a = _mm256_add_pd(a, _mm256_loadu_pd(values + i));
+
+    double sum = horizontal_sum(_mm256_add_pd(_mm256_add_pd(a, b), _mm256_add_pd(c, d)));
+
+    return sum + scalar_sum(values + i, length - i);
+};
+
+__attribute__((target("avx2,fma")))
+static double avx2_dot(const double* left, const double* right, size_t length) {
+    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd();
+    __m256d c = _mm256_setzero_pd(), d = _mm256_setzero_pd();
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        a = _mm256_fmadd_pd(_mm256_loadu_pd(left + i), _mm256_loadu_pd(right + i), a);
+        b = _mm256_fmadd_pd(_mm256_loadu_pd(left + i + 4), _mm256_loadu_pd(right + i + 4), b);
+        c = _mm256_fmadd_pd(_mm256_loadu_pd(left + i + 8), _mm256_loadu_pd(right + i + 8), c);
+        d = _mm256_fmadd_pd(_mm256_loadu_pd(left + i + 12), _mm256_loadu_pd(right + i + 12), d);
+    }
+
+    for (; i + 4 <= length; i += 4)
+        a = _mm256_fmadd_pd(_mm256_loadu_pd(left + i), _mm256_loadu_pd(right + i), a);
+
+    double dot = horizontal_sum(_mm256_add_pd(_mm256_add_pd(a, b), _mm256_add_pd(c, d)));
+
+    return dot + scalar_dot(left + i, right + i, length - i);
+};
+
+__attribute__((target("avx2,fma")))
+static double avx2_min(const double* values, size_t length) {
+    if (length < 8)
+        return scalar_min(values, length);
+
+    __m256d a = _mm256_loadu_pd(values), b = _mm256_loadu_pd(values + 4);
+    size_t i = 8;
+
+    for (; i + 8 <= length; i += 8) {
+        a = _mm256_min_pd(a, _mm256_loadu_pd(values + i));
+        b = _mm256_min_pd(b, _mm256_loadu_pd(values + i + 4));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_min_pd(a, b));
+
+    double min = scalar_min(lanes, 4);
+
+    for (; i < length; i++)
+        if (values[i] < min)
+            min = values[i];
+
+    return min;
+};
+
+__attribute__((target("avx2,fma")))
+static double avx2_max(const double* values, size_t length) {
+    if (length < 8)
+        return scalar_max(values, length);
+
+    __m256d a = _mm256_loadu_pd(values), b = _mm256_loadu_pd(values + 4);
+    size_t i = 8;
+
+    for (; i + 8 <= length; i += 8) {
+        a = _mm256_max_pd(a, _mm256_loadu_pd(values + i));
+        b = _mm256_max_pd(b, _mm256_loadu_pd(values + i + 4));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_max_pd(a, b));
+
+    double max = scalar_max(lanes, 4);
+
+    for (; i < length; i++)
+        if (values[i] > max)
+            max = values[i];
+
+    return max;
+};
+
+/**
+ * Compares the first and last byte of the needle at 32 positions at
+ * once, only candidates matching both are compared in full.
+ */
+__attribute__((target("avx2,fma")))
+static const char* avx2_find(const char* haystack, size_t length, const char* needle, size_t needle_length) {
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_length - 1]);
+    size_t i = 0;
+
+    for (; i + needle_length + 31 <= length; i += 32) {
+        __m256i block_first = _mm256_loadu_si256((const __m256i*)(haystack + i));
+        __m256i block_last = _mm256_loadu_si256((const __m256i*)(haystack + i + needle_length - 1));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(block_first, first),
+            _mm256_cmpeq_epi8(block_last, last)
+        ));
+
+        while (mask != 0) {
+            unsigned int bit = __builtin_ctz(mask);
+
+            if (memcmp(haystack + i + bit + 1, needle + 1, needle_length - 2) == 0)
+                return haystack + i + bit;
+
+            mask &= mask - 1;
+        }
+    }
+
+    const void* rest = memmem(haystack + i, length - i, needle, needle_length);
+
+    return (const char*)rest;
+};
+
+/**
+ * Sets or clears bit 5 of the bytes between `low` and `high`,
+ * bytes above 0x7f compare as negative and are never in range.
+ */
+__attribute__((target("avx2,fma")))
+static void avx2_fold(char* destination, const char* source, size_t length, char low, char high, bool lower) {
+    const __m256i below = _mm256_set1_epi8(low - 1);
+    const __m256i above = _mm256_set1_epi8(high + 1);
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(source + i));
+        __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi8(block, below), _mm256_cmpgt_epi8(above, block));
+
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_xor_si256(block, _mm256_and_si256(in_range, bit)));
+    }
+
+    for (; i < length; i++)
+        destination[i] = lower ? scalar_lower(source[i]) : scalar_upper(source[i]);
+};
+
+__attribute__((target("avx2,fma")))
+static __m256i avx2_lower_block(__m256i block) {
+    const __m256i below = _mm256_set1_epi8('A' - 1);
+    const __m256i above = _mm256_set1_epi8('Z' + 1);
+    __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi8(block, below), _mm256_cmpgt_epi8(above, block));
+
+    return _mm256_or_si256(block, _mm256_and_si256(in_range, _mm256_set1_epi8(0x20)));
+};
+
+__attribute__((target("avx2,fma")))
+static int avx2_compare_folded(const char* left, const char* right, size_t length) {
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m256i l = avx2_lower_block(_mm256_loadu_si256((const __m256i*)(left + i)));
+        __m256i r = avx2_lower_block(_mm256_loadu_si256((const __m256i*)(right + i)));
+        uint32_t equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r));
+
+        if (equal != 0xffffffff) {
+            size_t at = i + __builtin_ctz(~equal);
+            return scalar_compare_folded(left + at, right + at, 1);
+        }
+    }
+
+    return scalar_compare_folded(left + i, right + i, length - i);
+};
+#endif
+
+double simd_sum(const double* values, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_sum(values, length);
+#endif
+    return scalar_sum(values, length);
+};
+
+/**
+ * @param const double* values - at least one value
+ */
+double simd_min(const double* values, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_min(values, length);
+#endif
+    return scalar_min(values, length);
+};
+
+/**
+ * @param const double* values - at least one value
+ */
+double simd_max(const double* values, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_max(values, length);
+#endif
+    return scalar_max(values, length);
+};
+
+double simd_dot(const double* left, const double* right, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_dot(left, right, length);
+#endif
+    return scalar_dot(left, right, length);
+};
+
+const char* simd_find(const char* haystack, size_t length, const char* needle, size_t needle_length) {
+    if (needle_length == 0)
+        return haystack;
+    if (needle_length > length)
+        return nullptr;
+    if (needle_length == 1)
+        return (const char*)memchr(haystack, needle[0], length);
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_find(haystack, length, needle, needle_length);
+#endif
+    return (const char*)memmem(haystack, length, needle, needle_length);
+};
+
+void simd_lower(char* destination, const char* source, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_fold(destination, source, length, 'A', 'Z', true);
+#endif
+    for (size_t i = 0; i < length; i++)
+        destination[i] = scalar_lower(source[i]);
+};
+
+void simd_upper(char* destination, const char* source, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_fold(destination, source, length, 'a', 'z', false);
+#endif
+    for (size_t i = 0; i < length; i++)
+        destination[i] = scalar_upper(source[i]);
+};
+
+int simd_compare_folded(const char* left, const char* right, size_t length) {
+#ifdef SIMD_X86
+    if (simd_has_avx2())
+        return avx2_compare_folded(left, right, length);
+#endif
+    return scalar_compare_folded(left, right, length);
+};
@@ -0,0 +1,246 @@
+#include "includes/wscript_embed.h"
+#include "includes/Program.hpp"
+#include "includes/Interpreter.hpp"
+#include "includes/ExecutionContext.hpp"
+#include "includes/AST/AST_Value.hpp"
+#include "includes/AST/AST_Empty.hpp"
+#include <mutex>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+
+struct ws_script {
+    Program* program;
+};
+
+/**
+ * The output buffers belong to the context, so they are reused by every
+ * run like the rest of it.
+ */
+struct ws_context {
+    ExecutionContext* context;
+    Output* output;
+    Output* error;
+};
+
+struct ws_pool {
+    size_t max_idle;
+    std::mutex lock;
+    std::vector<ws_context*> idle;
+};
+
+static void discard(void* user, const char* data, size_t size) {};
+
+static char* copy_message(const std::string& message) {
+    char* copy = (char*)malloc(message.size() + 1);
+
+    if (copy != nullptr)
+        memcpy(copy, message.c_str(), message.size() + 1);
+
+    return copy;
+};
+
+static void set_error(char** error, const std::string& message) {
+    if (error != nullptr)
+        *error = copy_message(message);
+};
+
+static std::string identifier(const char* name) {
+    std::string lowered(name);
+
+    for (size_t i = 0; i < lowered.size(); i++)
+        lowered[i] = tolower(lowered[i]);
+
+    return lowered;
+};
+
+/**
+ * @return anything - throws std::runtime_error for types a script can
+ * not hold, and for doubles that would change as a Single.
+ */
+static anything from_value(const ws_variable& variable) {
+    const ws_value& value = variable.value;
+
+    switch (value.type) {
+        case WS_EMPTY: return new AST_Empty(nullptr);
+        case WS_BOOL: return value.as.boolean != 0;
+        case WS_INT: return value.as.integer;
+        case WS_DOUBLE: {
+            float number = (float)value.as.number;
+
+            if ((double)number != value.as.number && value.as.number == value.as.number)
+                throw std::runtime_error(std::string("variable `") + variable.name + "` does not fit a Single");
+
+            return number;
+        }
+        case WS_STRING:
+        case WS_BYTES: return std::string(value.as.span.data, value.as.span.size);
+        default: break;
+    }
+
+    throw std::runtime_error(std::string("unsupported type for variable `") + variable.name + "`");
+};
+
+static ws_value to_value(const anything& stored) {
+    ws_value value;
+    memset(&value, 0, sizeof(value));
+    value.type = WS_EMPTY;
+
+    if (stored.type() == typeid(bool)) {
+        value.type = WS_BOOL;
+        value.as.boolean = boost::get<bool>(stored);
+    } else if (stored.type() == typeid(int)) {
+        value.type = WS_INT;
+        value.as.integer = boost::get<int>(stored);
+    } else if (stored.type() == typeid(float)) {
+        value.type = WS_DOUBLE;
+        value.as.number = boost::get<float>(stored);
+    } else if (stored.type() == typeid(std::string)) {
+        const std::string& string = boost::get<std::string>(stored);
+
+        value.type = WS_STRING;
+        value.as.span.data = string.data();
+        value.as.span.size = string.size();
+    } else if (stored.type() == typeid(AST*)) {
+        if (AST_Value* wrapped = dynamic_cast<AST_Value*>(boost::get<AST*>(stored)))
+            return to_value(wrapped->value);
+    }
+
+    return value;
+};
+
+ws_script* ws_compile(const char* source, size_t size, char** error) {
+    try {
+        Program* program = new Program(std::string(source, size));
+        ws_script* script = new ws_script();
+        script->program = program;
+
+        return script;
+    } catch (std::exception& e) {
+        set_error(error, e.what());
+    }
+
+    return nullptr;
+};
+
+/**
+ * Keeps the tree, freeing an AST is not supported.
+ */
+void ws_script_free(ws_script* script) {
+    if (script == nullptr)
+        return;
+
+    delete script->program;
+    delete script;
+};
+
+ws_pool* ws_pool_create(size_t max_idle) {
+    ws_pool* pool = new ws_pool();
+    pool->max_idle = max_idle;
+
+    return pool;
+};
+
+static void free_context(ws_context* context) {
+    delete context->context;
+    delete context->output;
+    delete context->error;
+    delete context;
+};
+
+void ws_pool_free(ws_pool* pool) {
+    if (pool == nullptr)
+        return;
+
+    for (size_t i = 0; i < pool->idle.size(); i++)
+        free_context(pool->idle[i]);
+
+    delete pool;
+};
+
+ws_context* ws_acquire(ws_pool* pool) {
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+
+        if (!pool->idle.empty()) {
+            ws_context* context = pool->idle.back();
+            pool->idle.pop_back();
+
+            return context;
+        }
+    }
+
+    ws_context* context = new ws_context();
+    context->output = new Output(discard, nullptr, Output::Full);
+    context->error = new Output(discard, nullptr, Output::Full);
+    context->context = new ExecutionContext(context->output, context->error);
+
+    return context;
+};
+
+void ws_release(ws_pool* pool, ws_context* context) {
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+
+        if (pool->idle.size() < pool->max_idle) {
+            pool->idle.push_back(context);
+
+            return;
+        }
+    }
+
+    free_context(context);
+};
+
+int ws_run(ws_context* context, const ws_script* script, const ws_run_options* options, char** error) {
+    ws_run_options defaults;
+    memset(&defaults, 0, sizeof(defaults));
+
+    if (options == nullptr)
+        options = &defaults;
+
+    context->output->sink = options->output != nullptr ? options->output : discard;
+    context->output->sink_data = options->user;
+    context->error->sink = options->error != nullptr ? options->error : discard;
+    context->error->sink_data = options->user;
+
+    context->context->reset(context->output, context->error);
+
+    int status = 0;
+
+    try {
+        Scope* globals = context->context->globals;
+
+        for (size_t i = 0; i < options->variable_count; i++)
+            globals->set_variable(identifier(options->variables[i].name), from_value(options->variables[i]));
+
+        Interpreter interpreter(script->program, context->context);
+        interpreter.interpret();
+    } catch (std::exception& e) {
+        set_error(error, e.what());
+        status = -1;
+    }
+
+    context->output->flush();
+    context->error->flush();
+
+    // the host's `user` may be gone by the time Outputs are flushed at exit
+    context->output->sink = discard;
+    context->error->sink = discard;
+
+    return status;
+};
+
+int ws_get(ws_context* context, const char* name, ws_value* value) {
+    Scope* globals = context->context->globals;
+    std::map<std::string, anything>::iterator it = globals->variables.find(identifier(name));
+
+    if (it == globals->variables.end())
+        return 0;
+
+    *value = to_value(it->second);
+
+    return 1;
+};
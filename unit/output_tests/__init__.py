@@ -1,12 +1,12 @@
 import subprocess
 
 
-def binexec(filename):
+def binexec(filename, *args):
     out = subprocess.check_output([
         './wscript.out', 'unit/output_tests/code/{}'.format(filename)
-    ])
+    ] + list(args)).decode()
 
     if out:
-        return out[:-1] if out[len(out) - 1] == '\n' else out
+        return out[:-1] if out[-1] == '\n' else out
     else:
         return None
@@ -1,4 +1,7 @@
-from __init__ import binexec
+from . import binexec
+import os
+import subprocess
+import time
 
 
 def test_print_vbs():
@@ -66,7 +69,7 @@ def test_array_vbs():
 
 
 def test_array_ubound_vbs():
-    assert binexec('array_ubound.vbs') == '4'
+    assert binexec('array_ubound.vbs') == '3'
 
 
 def test_array_loop_vbs():
@@ -98,17 +101,42 @@ def test_dictionary_exists_vbs():
 
 
 def test_dictionary_keys_vbs():
-    assert binexec('dictionary_keys.vbs') == '[\nname\n,\nx\n,\n]'
+    assert binexec('dictionary_keys.vbs') == '[\nx\n,\nname\n,\n]'
 
 
 def test_dictionary_items_vbs():
-    assert binexec('dictionary_items.vbs') == '[\nJohn\n,\n123\n,\n]'
+    assert binexec('dictionary_items.vbs') == '[\n123\n,\nJohn\n,\n]'
 
 
 def test_dictionary_removeall_vbs():
     assert binexec('dictionary_removeall.vbs') == '1\n1\n0\n0'
 
 
+def test_dictionary_hashtable_vbs():
+    assert binexec('dictionary_hashtable.vbs') ==\
+        'three\nthree\nfloat\n10\n5\n0\n' +\
+        '[\na\n,\n3\n,\n1.5\n,\nc\n,\n]\n1\n1'
+
+
+def test_for_each_vbs():
+    assert binexec('for_each.vbs') ==\
+        'a\nc\n1\n3\na\nc\n1\nc\n2\n4\n5\n' +\
+        '6\na\nc\nz\nax\ncx\nzx\n120'
+
+
+def test_member_access_vbs():
+    assert binexec('member_access.vbs') == '4\n12\n3\n4\nhello\ne'
+
+
+def test_class_vbs():
+    assert binexec('class.vbs') ==\
+        'nobody\n1\n31\nHello, John\n6\n40\n1\nJohn'
+
+
+def test_with_vbs():
+    assert binexec('with.vbs') == '2\n12\n1\n1\n6'
+
+
 def test_split_vbs():
     assert binexec('split.vbs') ==\
         '[\nhello\n,\nworld\n,\nthis\n,\nis\n,\nsplit\n,\n]' +\
@@ -117,3 +145,115 @@ def test_split_vbs():
 
 def test_extension_requests_vbs():
     assert '<html>' in binexec('extension_requests.vbs')
+
+
+def test_array_dim_vbs():
+    assert binexec('array_dim.vbs') == '2\nx\nEmpty\n5\n12\n2'
+
+
+def test_array_redim_vbs():
+    assert binexec('array_redim.vbs') ==\
+        '4\n16\na\nb\nc\nEmpty\nEmpty'
+
+
+def test_array_typed_vbs():
+    assert binexec('array_typed.vbs') ==\
+        '0\n\n3.5\n2\n4\n8\n123\n2.5\n0\n5'
+
+
+def test_array_aggregates_vbs():
+    assert binexec('array_aggregates.vbs') ==\
+        '108\n4\n42\n1.5\n3\n5\n1\n-3\n3.25'
+
+
+def test_numbers_vbs():
+    assert binexec('numbers.vbs') == '0.33333334\n0.3\n1000000000000\n1E-06\nvalue: 2.5\n420.25\n2\n4\n1500'
+
+
+def test_strings_vbs():
+    assert binexec('strings.vbs') ==\
+        '3\na-b--c\n1 2.5 x\ntwo three\n-1\na|b|c\n' +\
+        '5\n8\n3\n0\n' +\
+        'a::b::c\nab.c\nyyyy\n' +\
+        'ript\ning\nmixed 123\nMIXED 123\n-1\n0\n1\n' +\
+        'banana\napple,cherry'
+
+
+def test_fso_vbs():
+    assert binexec('fso.vbs') ==\
+        '1\n1: first\n2: second 2\n3: third\nsecond 2\nthird\n\n0'
+
+
+def test_fso_folders_vbs():
+    assert binexec('fso_folders.vbs') ==\
+        'wscript_fso_folders\none.txt 1\n2\n6\n6\n2'
+
+
+def test_stdout_vbs():
+    assert binexec('stdout.vbs') == 'a1\nbetween\nb2.5\nend'
+
+
+def test_records_vbs():
+    assert binexec('records.vbs', '-p', 'unit/output_tests/code/records.txt') ==\
+        '1: 3\n2: 10\n3: 7\nlines: 3\ntotal: 20\nlargest: 10'
+    assert binexec('records.vbs', '-n', 'unit/output_tests/code/records.txt', 'unit/output_tests/code/records.txt') ==\
+        'lines: 6\ntotal: 40\nlargest: 10'
+
+
+def test_server_vbs():
+    sock = '/tmp/wscript_test_{}.sock'.format(os.getpid())
+    server = subprocess.Popen(['./wscript.out', '--serve', sock])
+
+    try:
+        while not os.path.exists(sock):
+            time.sleep(0.01)
+
+        for line in ['first', 'second']:
+            out = subprocess.check_output([
+                './wscript.out', '--client', sock, 'unit/output_tests/code/server.vbs'
+            ], input=(line + '\n').encode()).decode()
+
+            assert out == 'got: ' + line + '\n' + line.upper() + '\n'
+    finally:
+        server.kill()
+        server.wait()
+        os.unlink(sock)
+
+
+def test_batch():
+    for workers in [['-j', '1'], ['-j', '4'], ['--prefork', '2']]:
+        out = subprocess.check_output([
+            './wscript.out', '--batch', 'unit/output_tests/code/batch.txt'
+        ] + workers, stderr=subprocess.DEVNULL).decode()
+
+        assert out == '16\nhello\n0\n1\n2\n3\n2\n1\n16\n'
+
+
+def test_taskpool_vbs():
+    for threads in ['1', '4']:
+        env = dict(os.environ, WSCRIPT_TASK_THREADS=threads)
+        out = subprocess.check_output([
+            './wscript.out', 'unit/output_tests/code/TaskPool.vbs'
+        ], env=env).decode()
+
+        assert out == 'summed 10\n145\nsummed 1000\n499600\nsummed 3\n3\n99\n1\n7\n1\n'
+
+
+def test_taskpool_objects_vbs():
+    for threads in ['1', '4']:
+        env = dict(os.environ, WSCRIPT_TASK_THREADS=threads)
+        out = subprocess.check_output([
+            './wscript.out', 'unit/output_tests/code/TaskPool_objects.vbs'
+        ], env=env).decode()
+
+        assert out == '202\n202\n202\n9\n1\n5\n'
+
+
+def test_taskpool_refused_vbs():
+    run = subprocess.Popen([
+        './wscript.out', 'unit/output_tests/code/TaskPool_refused.vbs'
+    ], stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    out, err = run.communicate()
+
+    assert run.returncode != 0
+    assert b'`out` holds an object a task can not use' in err
@@ -9,10 +9,14 @@
 #include "../src/includes/AST/AST_Integer.hpp"
 #include "../src/includes/AST/AST_BinOp.hpp"
 #include "../src/includes/AST/AST_NoOp.hpp"
+#include "../src/includes/InlineCache.hpp"
+#include "../src/includes/wscript_embed.h"
+#include <thread>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
 
 
-Scope* global_scope = new Scope("global");
-
 Lexer* lexer = new Lexer(" ");
 Parser* parser = new Parser(lexer);
 Interpreter* interpreter = new Interpreter(parser);
@@ -63,3 +67,157 @@ TEST_CASE("AST_NoOp", "[Testing AST_NoOp]") {
 
     REQUIRE(boost::get<int>(interpreter->visit(op)) == 0);
 };
+
+TEST_CASE("Program", "[Running one Program on several threads]") {
+    Program program(
+        std::string("Dim total, i\n") +
+        std::string("total = 0\n") +
+        std::string("i = 0\n") +
+        std::string("Function AddSeed(n)\n") +
+        std::string("    AddSeed = n + seed\n") +
+        std::string("End Function\n") +
+        std::string("Do While i < 200\n") +
+        std::string("    total = total + AddSeed(i)\n") +
+        std::string("    i = i + 1\n") +
+        std::string("Loop\n")
+    );
+
+    std::vector<std::thread> threads;
+    std::vector<int> totals(8, -1);
+
+    for (int seed = 0; seed < 8; seed++) {
+        threads.push_back(std::thread([&program, &totals, seed]() {
+            ExecutionContext context(Output::standard());
+            Interpreter interpreter(&program, &context);
+
+            context.globals->set_variable("seed", seed);
+            interpreter.interpret();
+            totals[seed] = boost::get<int>(context.globals->get_variable("total"));
+        }));
+    }
+
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+
+    for (int seed = 0; seed < 8; seed++)
+        REQUIRE(totals[seed] == 19900 + 200 * seed);
+};
+
+static void append_output(void* user, const char* data, size_t size) {
+    ((std::string*)user)->append(data, size);
+};
+
+TEST_CASE("Embedding", "[Running a compiled script in pooled contexts]") {
+    const char* source =
+        "Dim total\n"
+        "If amount == 1 Then\n"
+        "    Dim first\n"
+        "    first = amount\n"
+        "End If\n"
+        "total = amount * 2\n"
+        "print(name)\n";
+    char* error = nullptr;
+    ws_script* script = ws_compile(source, strlen(source), &error);
+
+    REQUIRE(script != nullptr);
+
+    ws_pool* pool = ws_pool_create(1);
+    std::string output;
+
+    for (int amount = 1; amount <= 3; amount++) {
+        ws_variable variables[2];
+        variables[0].name = "Amount";
+        variables[0].value.type = WS_INT;
+        variables[0].value.as.integer = amount;
+        variables[1].name = "name";
+        variables[1].value.type = WS_STRING;
+        variables[1].value.as.span.data = "rule";
+        variables[1].value.as.span.size = 4;
+
+        ws_run_options options = { variables, 2, append_output, nullptr, &output };
+        ws_context* context = ws_acquire(pool);
+        ws_value value;
+
+        REQUIRE(ws_run(context, script, &options, &error) == 0);
+        REQUIRE(ws_get(context, "total", &value) == 1);
+        REQUIRE(value.type == WS_INT);
+        REQUIRE(value.as.integer == amount * 2);
+
+        // the pooled context forgets the variables of the previous run
+        REQUIRE(ws_get(context, "first", &value) == (amount == 1 ? 1 : 0));
+
+        ws_release(pool, context);
+    }
+
+    REQUIRE(output == "rule\nrule\nrule\n");
+
+    ws_context* context = ws_acquire(pool);
+
+    REQUIRE(ws_run(context, script, nullptr, &error) == -1);
+    REQUIRE(std::string(error).find("amount") != std::string::npos);
+    free(error);
+
+    ws_variable variables[2];
+    variables[0].name = "amount";
+    variables[0].value.type = WS_DOUBLE;
+    variables[0].value.as.number = 0.5;
+    variables[1].name = "name";
+    variables[1].value.type = WS_EMPTY;
+
+    ws_run_options options = { variables, 2, nullptr, nullptr, nullptr };
+    ws_value value;
+
+    REQUIRE(ws_run(context, script, &options, &error) == 0);
+    REQUIRE(ws_get(context, "total", &value) == 1);
+    REQUIRE(value.as.number == 1.0);
+
+    // 0.1 would be a different number as a Single
+    variables[0].value.as.number = 0.1;
+
+    REQUIRE(ws_run(context, script, &options, &error) == -1);
+    REQUIRE(std::string(error).find("Single") != std::string::npos);
+    free(error);
+
+    ws_release(pool, context);
+    ws_pool_free(pool);
+    ws_script_free(script);
+
+    REQUIRE(ws_compile("If Then\n", strlen("If Then\n"), &error) == nullptr);
+    free(error);
+};
+
+TEST_CASE("AST_TypedArray", "[Storing values out of an element type's range]") {
+    const char* sources[] = {
+        "Dim a(0) As Byte\na(0) = 256\n",
+        "Dim a(0) As Integer\na(0) = -32769\n",
+        "Dim a(0) As Long\na(0) = 3000000000.0\n"
+    };
+    ws_pool* pool = ws_pool_create(1);
+
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+        char* error = nullptr;
+        ws_script* script = ws_compile(sources[i], strlen(sources[i]), &error);
+        ws_context* context = ws_acquire(pool);
+
+        REQUIRE(script != nullptr);
+        REQUIRE(ws_run(context, script, nullptr, &error) == -1);
+        REQUIRE(std::string(error).find("Overflow") != std::string::npos);
+        free(error);
+
+        ws_release(pool, context);
+        ws_script_free(script);
+    }
+
+    ws_pool_free(pool);
+};
+
+TEST_CASE("InlineCache", "[Call sites that see more classes than the cache holds]") {
+    InlineCache cache;
+    int classes[InlineCache::SIZE * 4];
+
+    for (int i = 0; i < InlineCache::SIZE * 4; i++)
+        cache.add(&classes[i], (AST_BuiltinFunctionDefinition*)&classes[i]);
+
+    for (int i = 0; i < InlineCache::SIZE * 4; i++)
+        REQUIRE(cache.find(&classes[i]) == (i < InlineCache::SIZE ? (AST_BuiltinFunctionDefinition*)&classes[i] : nullptr));
+};